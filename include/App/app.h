@@ -58,7 +58,8 @@ typedef enum {
     SCENE_MISSION_BRIEFING, /**< Mission briefing scene */
     SCENE_CONTROLS,
     SCENE_SETTINGS,
-    SCENE_WIN      /**< Win scene when mission is accomplished */
+    SCENE_WIN,      /**< Win scene when mission is accomplished */
+    SCENE_STRESS_TEST /**< Debug scene that floods a room with enemies and reports timings */
 } AppScene;
 
 /**
@@ -96,6 +97,19 @@ typedef struct AppConfig {
     int screen_height; /**< The screen height */
 
     bool debug; /**< Flag indicating if debug mode is enabled */
+
+    int enemyCapacity; /**< Number of enemy slots, set with --enemy-capacity */
+    int enemyWaveLimit; /**< Maximum number of enemies a single wave can spawn, set with --enemy-wave-limit */
+    int stressEnemyCount; /**< Enemies of each type spawned by the stress test, 0 disables it. Set with --stress */
+    int headlessFrames; /**< Frames to run without a display or audio before quitting, 0 for a normal run. Set with --headless */
+    int tickRate; /**< Simulation steps per second, independent of the frame rate. Set with --tick-rate */
+    int spikeThresholdMs; /**< Frames slower than this many milliseconds write a spike capture, 0 disables it. Set with --spike-capture */
+    char* profileTracePath; /**< File the profiler trace is written to on quit, NULL to not record. Set with --profile-trace */
+    int mapSize; /**< Chunks per side of generated maps, set with --map-size */
+    int mapLength; /**< Steps of the main path of generated maps, set with --map-length */
+    int seed; /**< Seed of every run, 0 for a new one each run. Set with --seed */
+    char* recordPath; /**< File the session's input is recorded to, NULL to not record. Set with --record */
+    char* replayPath; /**< Recording to play back headless, NULL for a normal run. Set with --replay */
     
     char* title1FontPath; /**< The file path for title 1 font */
     char* title2FontPath; /**< The file path for title 2 font */
@@ -124,6 +138,15 @@ typedef struct AppData {
  */
 extern AppData app;
 
+/**
+ * @brief Reads startup parameters from the command line into app.config
+ * 
+ * @param argc Number of arguments
+ * @param argv Argument strings, argv[0] being the program name
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int App_ParseArguments(int argc, char* argv[]);
+
 /**
  * @brief Initializes the app and starts the game loop
  * 
@@ -165,4 +188,17 @@ int App_Event_Handler(SDL_Event *event);
  * 
  * @return int Status code (0 for success, non-zero for error)
  */
-int App_Quit();
\ No newline at end of file
+int App_Quit();
+
+/**
+ * @brief Records the timing of one headless frame, and stops the app once enough frames ran
+ * 
+ * @param updateTicks Performance counter ticks spent in the update routines
+ * @param renderTicks Performance counter ticks spent in App_Render()
+ */
+void App_RecordHeadlessFrame(Uint64 updateTicks, Uint64 renderTicks);
+
+/**
+ * @brief Prints the timing collected over a headless run, with percentiles per scene and stage
+ */
+void App_ReportHeadlessTiming();
\ No newline at end of file
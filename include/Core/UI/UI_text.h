@@ -22,9 +22,17 @@
  * // Changing text content dynamically
  * UI_ChangeText(scoreText, "Score: 1500");
  * 
- * // Changing text color
+ * // Changing text color (only changes the color mod, the texture is reused)
  * UI_ChangeTextColor(warningText, (SDL_Color){255, 0, 0, 255});
  * ```
+ *
+ * @section text_cache Text Cache
+ *
+ * Text textures are rendered in white and shared through an LRU cache keyed
+ * by font and string. Textures that no element uses anymore stay cached
+ * until the cache goes over UI_TEXT_CACHE_MAX_ENTRIES or
+ * UI_TEXT_CACHE_MAX_BYTES. Since the texture is shared, never set color or
+ * alpha mods on it directly, use UI_ChangeTextColor() instead.
  */
 
 #pragma once
@@ -32,6 +40,16 @@
 #include <UI.h>
 #include <SDL_ttf.h>
 
+/**
+ * @brief Maximum number of text textures kept in the cache
+ */
+#define UI_TEXT_CACHE_MAX_ENTRIES 256
+
+/**
+ * @brief Texture memory the cache may hold before unused textures are evicted
+ */
+#define UI_TEXT_CACHE_MAX_BYTES (8 * 1024 * 1024)
+
 /**
  * @brief An enum for text alignment
  */
@@ -49,7 +67,7 @@ typedef enum {
  */
 typedef struct UI_TextData {
     char* text;                 /**< Text content to display */
-    SDL_Texture* textTexture;   /**< Pre-rendered text texture */
+    SDL_Texture* textTexture;   /**< Shared white text texture from the text cache */
     TTF_Font* font;             /**< Font used for text rendering */
     UI_TextAlignment alignment; /**< Text alignment (left, center, or right) */
 } UI_TextData;
@@ -59,6 +77,25 @@ UIElement* UI_CreateText(const char* text, SDL_Rect rect,
                         TTF_Font* font);
 SDL_Texture* UI_CreateTextTexture(const char* text, SDL_Color color, TTF_Font* font);
 
+/**
+ * @brief Returns a cached white texture of a string, must be paired with UI_ReleaseTextTexture()
+ * @param text The string to render
+ * @param font The font to render it with
+ * @return SDL_Texture* The shared texture, or NULL for an empty string
+ */
+SDL_Texture* UI_AcquireTextTexture(const char* text, TTF_Font* font);
+
+/**
+ * @brief Gives back a texture from UI_AcquireTextTexture()
+ * @param texture The texture to release, may be NULL
+ */
+void UI_ReleaseTextTexture(SDL_Texture* texture);
+
+/**
+ * @brief Destroys every cached text texture
+ */
+void UI_ClearTextCache();
+
 void UI_UpdateText(UIElement* element);
 void UI_RenderText(UIElement* element);
 void UI_DestroyText(UIElement* element);
@@ -73,7 +73,7 @@
 #include <stdbool.h>
 
 #define MAX_COLLISIONS_PER_CHECK 20
-#define MAX_COLLIDABLES 1024
+#define MAX_COLLIDABLES 1024 ///< Registry slots reserved for everything except enemies
 
 // Collision layers as bitmasks for efficient checking
 typedef enum {
@@ -84,6 +84,7 @@ typedef enum {
     COLLISION_LAYER_TRIGGER             = 1 << 3,   // 00001000
     COLLISION_LAYER_ENEMY_PROJECTILE    = 1 << 4,   // 00010000
     COLLISION_LAYER_PLAYER_PROJECTILE   = 1 << 5,   // 00100000
+    COLLISION_LAYER_ENEMY_SPAWNING      = 1 << 6,   // 01000000 Enemies still spawning in, only in the way of other enemies
 } CollisionLayer;
 
 /**
@@ -101,8 +102,21 @@ typedef struct Collider {
     bool active; ///< Is this collidable active?
 } Collider;
 
-extern Collider* ColliderList[MAX_COLLIDABLES];
+extern Collider** ColliderList;
 extern int ColliderCount;
+extern int ColliderCapacity;
+
+/**
+ * Collision query counters, used by the stress test to attribute
+ * collision cost. Only accumulated while enabled is true.
+ */
+typedef struct ColliderStats {
+    bool enabled; ///< Whether Collider_Check should time itself
+    Uint64 checkTicks; ///< Performance counter ticks spent inside Collider_Check
+    int checkCount; ///< Number of Collider_Check calls
+} ColliderStats;
+
+extern ColliderStats ColliderProfile;
 
 /**
  * This struct is used to store the results of a Collider_Check call.
@@ -116,8 +130,11 @@ typedef struct ColliderCheckResult {
 } ColliderCheckResult;
 
 
-/** Initialize the collision manager */
-void Collider_Start();
+/**
+ * Initialize the collision manager
+ * @param capacity Number of registry slots to allocate
+ */
+void Collider_Start(int capacity);
 
 /** 
  * Register a collider with the collision manager
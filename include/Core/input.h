@@ -78,8 +78,10 @@ extern const InputEvent * const Input;
 
 void Input_Init();
 void Input_PreUpdate();
+void Input_EndFixedStep();
 void Input_Event_Handler(SDL_Event *event);
 bool Input_MouseIsOnRect(SDL_Rect rect);
+void Input_SetMousePosition(Vec2 position);
 
 // Action state getters
 bool Input_IsActionPressed(GameAction action);
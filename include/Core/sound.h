@@ -89,6 +89,7 @@ extern SoundResources soundResources;
 
 // Function declarations
 bool Sound_System_Initialize();
+void Sound_QueueAssets();
 bool Sound_Load_Resources();
 void Sound_Play_Music(const char* path, int loops);
 void Sound_Play_Effect(int index);
@@ -23,12 +23,44 @@
  * ```
  * This way, the object will move up 5 units per second regardless of the frame rate.
  * 
+ * @subsection fixed_step Fixed Step
+ * The simulation (App_PostUpdate()) runs in fixed steps of fixedDeltaTimeSeconds,
+ * as many per frame as the real time that passed requires:
+ * ```c
+ * while (Time_BeginFixedStep()) App_PostUpdate(); // deltaTimeSeconds is one step here
+ * Time_EndFixedSteps();                           // deltaTimeSeconds is the frame time again
+ * App_Render();                                   // draws between the last two steps (interpolationAlpha)
+ * ```
+ * So code in the update routines always sees the same delta time, while
+ * render-time effects keep using the frame time.
+ * 
  * @author Mango
  * @date 2025-01-03
  */
 
 #pragma once
 #include <SDL.h>
+#include <stdbool.h>
+
+/**
+ * @brief Default number of simulation steps per second
+ */
+#define TIME_DEFAULT_TICK_RATE 60
+
+/**
+ * @brief Most simulation steps run in one frame, time beyond that is dropped
+ * 
+ * Keeps a slow frame from causing even more steps the next frame (spiral of death).
+ */
+#define TIME_MAX_STEPS_PER_FRAME 5
+
+/**
+ * @brief How close to the frame deadline the limiter stops sleeping and spins instead
+ * 
+ * SDL_Delay() can oversleep by a millisecond or more, so the last stretch
+ * is waited out on the performance counter.
+ */
+#define TIME_LIMITER_SPIN_MILLISECONDS 2.0
 
 /**
  * @brief Structure to handle time-related functionality
@@ -39,7 +71,11 @@ typedef struct TimeSystem {
     float rawDeltaTimeSeconds; /**< Delta time multiplied by time scale */
     double programElapsedTimeSeconds; /**< Total time elapsed since program start */
     double rawProgramElapsedTimeSeconds; /**< Total time elapsed since program start without time scale */
-    double previousTick;         /**< Previous frame tick value */
+    Uint64 previousCounter;      /**< Performance counter value at the start of the previous frame */
+    float fixedDeltaTimeSeconds; /**< Length of one simulation step in seconds, before time scale */
+    double accumulatorSeconds;   /**< Real time that has passed but has not been simulated yet */
+    float interpolationAlpha;    /**< Where rendering is between the previous (0) and the latest (1) step */
+    double frameSeconds;         /**< Real time of the current frame as added to the accumulator, what replays store */
 } TimeSystem;
 
 extern const TimeSystem * const Time;
@@ -48,3 +84,8 @@ void Time_PreUpdate();
 void Time_UpdateFPS();
 void Time_SetTimeScale(float scale);
 void Time_ResetTotalTime();
+void Time_SetTickRate(int ticksPerSecond);
+bool Time_BeginFixedStep();
+void Time_EndFixedSteps();
+void Time_LimitFrameRate(int maxFps);
+void Time_SetFrameSeconds(double seconds);
@@ -15,8 +15,17 @@
 #include <timer.h>
 #include <particle_emitterpresets.h>
 #include <chunks.h>
+#include <sprite_atlas.h>
 
-#define ENEMY_MAX 100
+/**
+ * @brief Default number of enemy slots, used unless --enemy-capacity is given
+ */
+#define ENEMY_DEFAULT_CAPACITY 100
+
+/**
+ * @brief Default cap on how many enemies a single wave can spawn
+ */
+#define ENEMY_DEFAULT_WAVE_LIMIT 25
 
 extern ParticleEmitter* TacticianBuffEffectEmitter;
 
@@ -55,6 +64,8 @@ typedef struct EnemyState {
     int currentHealth;   /**< Current health points */
     bool isDead;         /**< Whether the enemy is dead */
     bool isSpawning;     /**< Whether the enemy is in spawning state */
+    bool isTracked;      /**< Whether the enemy slot is listed in its type bucket */
+    ChunkSpawnReservation spawnReservation; /**< Spawn grid tiles under the enemy, moved with it and held until it is swept out of its bucket */
 
     SDL_RendererFlip flip;
 
@@ -121,14 +132,37 @@ extern EnemyData* enemyList[ENEMY_TYPE_COUNT];
 /**
  * @brief Array of enemies
  *
- * Holds all the enemies in the game
+ * Holds all the enemies in the game. Allocated once by Enemy_Init() with
+ * Enemy_Capacity slots and never moved, since colliders point into it.
+ */
+extern EnemyData* enemies;
+
+/**
+ * @brief Number of slots in the enemies array
+ */
+extern int Enemy_Capacity;
+
+/**
+ * @brief Dense list of live enemies of a single type
+ *
+ * Holds indices into the enemies array so update and render passes can
+ * run each type as one batch without visiting dead slots. Entries of enemies
+ * that died are swept out by Enemy_CompactBuckets().
  */
-extern EnemyData enemies[ENEMY_MAX];
+typedef struct EnemyBucket {
+    int* indices;           /**< Indices into the enemies array, Enemy_Capacity long */
+    int count;              /**< Number of entries in use */
+} EnemyBucket;
 
 /**
- * @brief Texture for enemy spawn indicator
+ * @brief Live enemy buckets, one per enemy type
  */
-extern SDL_Texture* Enemy_spawnIndicator;
+extern EnemyBucket EnemyBuckets[ENEMY_TYPE_COUNT];
+
+/**
+ * @brief Sprite atlas region of the enemy spawn indicator
+ */
+extern SpriteRegion Enemy_spawnIndicator;
 
 typedef struct EnemySpawnData {
     EnemyType type;
@@ -155,8 +189,15 @@ extern EnemyComp EnemyComps[20];
  */
 void Enemy_ResetComp(EnemyComp* comp);
 
+/**
+ * @brief Queues the enemy spritesheets for the startup asset loader
+ */
+void Enemy_QueueAssets();
+
 void Enemy_Init();
 void Enemy_Update();
+void Enemy_UpdateType(EnemyType type);
+void Enemy_UpdateEffects();
 void Enemy_HandleSpawning(EnemyData* enemy);
 void Enemy_HandleMovement(EnemyData* enemy);
 void Enemy_TryMove(EnemyData* enemy, Vec2 movement);
@@ -164,12 +205,19 @@ void Enemy_HandleDeath(EnemyData* enemy);
 void EnemyManager_Update();
 void EnemyManager_RenderClearText();
 void Enemy_Render();
+void Enemy_RenderType(EnemyType type);
+void Enemy_RenderEffects();
 void Enemy_Destroy();
-void Enemy_Spawn(EnemyData data, Vec2 position);
+EnemyData* Enemy_Spawn(EnemyData data, Vec2 position);
+EnemyData* Enemy_SpawnInRoom(EnemyData data, EnvironmentChunk* chunk);
 void Enemy_SpawnWave(EnvironmentChunk* chunk);
 void Enemy_TakeDamage(EnemyData* enemy, int damage);
+void Enemy_InitHealthTexts();
 void Enemy_CreateHealthText(Vec2 position, int damage);
 void Enemy_UpdateHealthTexts();
 void Enemy_RenderHealthTexts();
 int EnemyManage_CountEnemyInChunk(EnvironmentChunk* chunk);
-EnemyData* Enemy_SelectRandomEnemyInComp(EnemyComp* comp);
\ No newline at end of file
+EnemyData* Enemy_SelectRandomEnemyInComp(EnemyComp* comp);
+void Enemy_ResetBuckets();
+void Enemy_TrackLive(EnemyData* enemy);
+void Enemy_CompactBuckets();
\ No newline at end of file
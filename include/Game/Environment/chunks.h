@@ -77,6 +77,36 @@ typedef enum {
     HALLWAY_RIGHT   = 1 << 3,   /**< Hallway right */
 } RoomHallways;
 
+/**
+ * @def CHUNK_DOOR_COUNT
+ * @brief Number of doors a room can have, one per hallway direction
+ */
+#define CHUNK_DOOR_COUNT 4
+
+/**
+ * @def CHUNK_MAX_COLLIDERS
+ * @brief Colliders a chunk can hold besides its walls: room, exit, and a trigger and door per hallway
+ */
+#define CHUNK_MAX_COLLIDERS 16
+
+/**
+ * @def CHUNK_SPAWN_GRIDS
+ * @brief Rooms whose spawn occupancy grid is kept at once, the oldest is rebuilt when another room needs one
+ */
+#define CHUNK_SPAWN_GRIDS 4
+
+/**
+ * @brief Tiles of a room's spawn grid held by one enemy, see Chunk_TakeSpawnTile()
+ */
+typedef struct ChunkSpawnReservation {
+    Uint32 gridId;  /**< Grid the tiles are held in, 0 for none */
+    Uint8 grid;     /**< Slot of the grid */
+    Uint8 startX;   /**< Chunk-local first column held */
+    Uint8 startY;   /**< Chunk-local first row held */
+    Uint8 endX;     /**< Chunk-local last column held */
+    Uint8 endY;     /**< Chunk-local last row held */
+} ChunkSpawnReservation;
+
 /**
  * @enum RoomFloorPattern
  * @brief Possible floor patterns in a room
@@ -105,34 +135,42 @@ typedef enum {
 typedef struct {
     Vec2 position;  /**< Position of the chunk */
 
-    EnvironmentTile tiles[CHUNK_SIZE_TILE][CHUNK_SIZE_TILE]; /**< Tiles in the chunk */
+    EnvironmentTile tiles[CHUNK_SIZE_TILE][CHUNK_SIZE_TILE]; /**< Tiles in the chunk, one byte each */
 
     Vec2 roomSize;  /**< Size of the room in the chunk */
     RoomHallways hallways;  /**< Hallways in the room */
     RoomFloorPattern floorPattern;  /**< Floor pattern in the room */
+    Uint32 floorSeed;  /**< Seed of the random floor pattern, rolled from the map's generator */
     RoomType roomType;  /**< Type of the room */
     
     int totalEnemyCount;  /**< Total number of enemies in the room */
     int currentEnemyCount;  /**< Current number of enemies in the room */
     bool inCombat;  /**< Whether the room is in combat */
-    bool empty;  /**< Whether the room is empty */
     bool discovered;  /**< Whether the room is discovered */
 
-    Collider* colliders[CHUNK_SIZE_TILE];  /**< Colliders in the chunk */
-    int colliderCount;  /**< Number of colliders in the chunk */
+    Collider* walls;  /**< Wall colliders merged from the solid tiles, one block owned by the chunk */
+    int wallCount;  /**< Number of wall colliders */
+    Collider* colliders[CHUNK_MAX_COLLIDERS];  /**< Triggers, doors and other colliders that do not follow the tiles */
+    int colliderCount;  /**< Number of colliders in colliders */
+    Collider* doorColliders[CHUNK_DOOR_COUNT];  /**< Door collider of each hallway, also in colliders. Indexed up, down, left, right */
+    Collider* hallwayTriggers[CHUNK_DOOR_COUNT];  /**< Trigger of each hallway, also in colliders. Indexed like doorColliders */
+    RoomHallways doorsClosed;  /**< Hallways whose door is closed */
+
+    int crateGun;  /**< Gun in the weapon crate of a crate room */
+    int crateLog;  /**< Log placed in a crate room, 0 for none */
 } EnvironmentChunk;
 
 /**
  * @brief Generates tiles for a chunk
  * 
+ * @param chunk Pointer to the chunk to fill
  * @param position Position of the chunk
  * @param roomType Type of the room
  * @param roomSize Size of the room
  * @param floorPattern Floor pattern of the room
  * @param hallways Hallways in the room
- * @return EnvironmentChunk Generated chunk
  */
-EnvironmentChunk Chunk_GenerateTiles(Vec2 position, RoomType roomType, Vec2 roomSize ,RoomFloorPattern floorPattern, RoomHallways hallways);
+void Chunk_GenerateTiles(EnvironmentChunk* chunk, Vec2 position, RoomType roomType, Vec2 roomSize, RoomFloorPattern floorPattern, RoomHallways hallways);
 
 /**
  * @brief Generates void tiles for a chunk
@@ -176,6 +214,20 @@ void Chunk_GenerateHallwayWallTiles(EnvironmentChunk* chunk);
  */
 void Chunk_GenerateColliders(EnvironmentChunk* chunk);
 
+/**
+ * @brief Builds the wall colliders of a chunk from its solid tiles
+ * 
+ * @param chunk Pointer to the chunk, its previous walls must be released
+ */
+void Chunk_GenerateWallColliders(EnvironmentChunk* chunk);
+
+/**
+ * @brief Unregisters and frees every collider of a chunk
+ * 
+ * @param chunk Pointer to the chunk
+ */
+void Chunk_ReleaseColliders(EnvironmentChunk* chunk);
+
 /**
  * @brief Adds a wall collider to a chunk
  * 
@@ -185,6 +237,35 @@ void Chunk_GenerateColliders(EnvironmentChunk* chunk);
  */
 void Chunk_AddWallCollider(Vec2 startTile, Vec2 endtile, EnvironmentChunk* chunk);
 
+/**
+ * @brief Gets the slot of a door in EnvironmentChunk.doorColliders and hallwayTriggers
+ * 
+ * @param door A single hallway direction
+ * @return int The slot, or -1 if door is not a single direction
+ */
+int Chunk_GetDoorIndex(RoomHallways door);
+
+/**
+ * @brief Adds the collider of a hallway's door to a chunk, open at first
+ * 
+ * @param door The hallway the door belongs to
+ * @param startTile Starting tile of the door
+ * @param endTile Ending tile of the door
+ * @param chunk Pointer to the chunk
+ */
+void Chunk_AddDoorCollider(RoomHallways door, Vec2 startTile, Vec2 endTile, EnvironmentChunk* chunk);
+
+/**
+ * @brief Opens or closes the doors of a room's hallways
+ * 
+ * Only rewrites the tiles and colliders of the doors that change. The
+ * hallway trigger behind a closed door is switched off with it.
+ * 
+ * @param chunk Pointer to the chunk
+ * @param closed The hallways whose door should be closed, the others are opened
+ */
+void Chunk_SetDoorsClosed(EnvironmentChunk* chunk, RoomHallways closed);
+
 /**
  * @brief Adds a room trigger to a chunk
  * 
@@ -197,11 +278,12 @@ void Chunk_AddRoomTrigger(Vec2 startTile, Vec2 endtile, EnvironmentChunk* chunk)
 /**
  * @brief Adds a hallway trigger to a chunk
  * 
+ * @param hallway The hallway the trigger covers
  * @param startTile Starting tile of the hallway
  * @param endtile Ending tile of the hallway
  * @param chunk Pointer to the chunk
  */
-void Chunk_AddHallwayTrigger(Vec2 startTile, Vec2 endtile, EnvironmentChunk* chunk);
+void Chunk_AddHallwayTrigger(RoomHallways hallway, Vec2 startTile, Vec2 endtile, EnvironmentChunk* chunk);
 
 /**
  * @brief Adds an end trigger to a chunk
@@ -271,6 +353,42 @@ Vec2 Chunk_GetRandomTileInRoom(EnvironmentChunk* chunk);
  */
 Vec2 Chunk_GetRandomTileCenterInRoom(EnvironmentChunk* chunk);
 
+/**
+ * @brief Reserves a free spawn point in a room
+ * 
+ * The room's occupancy grid is built on its first spawn and kept up to
+ * date by the reservations, so this is O(1) in practice.
+ * 
+ * @param chunk Pointer to the chunk
+ * @param hitboxSize Size in pixels of the hitbox to place
+ * @param position Receives the world position of the tile center
+ * @param reservation Receives the tiles held for the hitbox
+ * @return true If a free spot was found and reserved
+ * @return false If the room has no free spot left for this hitbox
+ */
+bool Chunk_TakeSpawnTile(EnvironmentChunk* chunk, Vec2 hitboxSize, Vec2* position, ChunkSpawnReservation* reservation);
+
+/**
+ * @brief Gives back the tiles of a reservation made by Chunk_TakeSpawnTile()
+ * 
+ * @param reservation The reservation, emptied
+ */
+void Chunk_ReleaseSpawnTile(ChunkSpawnReservation* reservation);
+
+/**
+ * @brief Moves a reservation onto the tiles a hitbox covers, called whenever its enemy moves
+ * 
+ * @param reservation The reservation to move
+ * @param position Center of the hitbox in world coordinates
+ * @param size Size of the hitbox in pixels
+ */
+void Chunk_MoveSpawnReservation(ChunkSpawnReservation* reservation, Vec2 position, Vec2 size);
+
+/**
+ * @brief Forgets every room's spawn grid, called when the map's rooms are released
+ */
+void Chunk_ResetSpawnGrids();
+
 /**
  * @brief Checks if a chunk index is valid
  * 
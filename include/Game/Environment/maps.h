@@ -10,27 +10,48 @@
 
 #include <SDL.h>
 #include <chunks.h>
+#include <random.h>
 
-// Maps are 5 chunks wide and 5 chunks tall
-#define MAP_SIZE_CHUNK 8 //im changing this mango
-#define MAP_SIZE_TILE (MAP_SIZE_CHUNK * CHUNK_SIZE_TILE)
-#define MAP_LENGTH 7
+/** @brief Chunks per side of a map, unless set with --map-size */
+#define MAP_DEFAULT_SIZE_CHUNK 8
+
+/** @brief Smallest map side, the boss stage needs two rooms above the start room */
+#define MAP_MIN_SIZE_CHUNK 5
+
+/** @brief Steps of the main path, unless set with --map-length */
+#define MAP_DEFAULT_LENGTH 7
+
+/** @brief Rooms a single main path step can add at most, one per branch */
+#define MAP_MAX_BRANCHES 3
 
 /**
  * @struct EnvironmentMap
  * @brief Represents a game environment map composed of chunks
  * 
- * The map is organized as a grid of environment chunks with defined start and end points,
- * and contains a main path through the map.
+ * The map is a width x height grid of chunk positions, but only the rooms
+ * are stored: they are allocated from a pool sized for the path length,
+ * and the grid holds a pointer to each room, NULL where there is none.
+ * Both are allocated by Map_Generate() and kept while the size stays the same.
+ * 
+ * Generating a map is split in two: Map_GenerateLayout() only writes to the
+ * map itself and may run on another thread, Map_Build() then registers the
+ * colliders and interactables on the main thread.
  */
 typedef struct {
-    EnvironmentChunk chunks[MAP_SIZE_CHUNK][MAP_SIZE_CHUNK]; /**< 2D array of environment chunks that make up the map */
+    int width; /**< Chunks per row of the grid */
+    int height; /**< Chunks per column of the grid */
+    EnvironmentChunk** grid; /**< width * height cells, row by row, NULL where there is no room */
+    EnvironmentChunk* chunks; /**< Pool of rooms, the first chunkCount are in use */
+    int chunkCount; /**< Number of rooms in the map */
+    int chunkCapacity; /**< Number of rooms the pool can hold */
+    int length; /**< Steps of the main path the pool was sized for */
     EnvironmentChunk* startChunk; /**< Pointer to the starting chunk of the map */
     EnvironmentChunk* endChunk; /**< Pointer to the ending chunk of the map */
-    Vec2 mainPath[MAP_SIZE_CHUNK * MAP_SIZE_CHUNK]; /**< Array of positions representing the main path through the map */
-    Vec2 alternatePath[MAP_SIZE_CHUNK * MAP_SIZE_CHUNK]; /**< Array of positions representing the alternate path through the map */
-    int alternatePathLength; /**< The number of positions in the main path */
+    Vec2* mainPath; /**< Positions of the main path through the map, length + 1 entries */
+    Vec2* alternatePath; /**< Positions of the rooms off the main path, chunkCapacity entries */
+    int alternatePathLength; /**< The number of positions in the alternate path */
     int mainPathLength; /**< The number of positions in the main path */
+    RandomState random; /**< Generator the layout is rolled with, seeded by Map_GenerateLayout() */
 } EnvironmentMap;
 
 /**
@@ -49,36 +70,131 @@ void Map_Start();
 void Map_Render();
 
 /**
- * @brief Generate a new map
+ * @brief Generate a new map for the current stage, replacing testMap right away
  */
 void Map_Generate();
 
+/**
+ * @brief Roll the rooms, paths and tiles of a map
+ * 
+ * Only touches the map itself, so it is safe to run off the main thread.
+ * The same stage and seed always give the same layout.
+ * 
+ * @param map The map to fill, its previous colliders must already be released
+ * @param stage The stage the map is for, stage 10 being the boss stage
+ * @param seed Seed of the map's generator
+ */
+void Map_GenerateLayout(EnvironmentMap* map, int stage, Uint64 seed);
+
+/**
+ * @brief Register the colliders and interactables of a laid out map
+ * 
+ * Must run on the main thread, after Map_GenerateLayout().
+ * 
+ * @param map The map to build
+ */
+void Map_Build(EnvironmentMap* map);
+
+/**
+ * @brief Free the colliders of every room of a map
+ * 
+ * @param map The map whose colliders to free
+ */
+void Map_ReleaseColliders(EnvironmentMap* map);
+
+/**
+ * @brief Start generating the layout of the next map on a worker thread
+ * 
+ * @param stage The stage the map is for
+ * @param seed Seed of the map's generator
+ */
+void Map_GenerateInBackground(int stage, Uint64 seed);
+
+/**
+ * @brief Replace testMap with the map generated in the background
+ * 
+ * Waits for the worker if it is not done yet, then builds the new map on the
+ * calling thread. Falls back to Map_Generate() if nothing was started.
+ */
+void Map_FinishBackgroundGeneration();
+
+/**
+ * @brief Wait for the background worker and throw away what it generated
+ */
+void Map_CancelBackgroundGeneration();
+
+/**
+ * @brief Allocate the grid and chunk pool of a map, and empty it
+ * 
+ * Storage is only reallocated when the size or length changed, so pointers
+ * to rooms of the previous map must not be used after this.
+ * 
+ * @param map The map to prepare
+ * @param size Chunks per side of the grid
+ * @param length Steps of the main path, used to size the pool
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int Map_Reserve(EnvironmentMap* map, int size, int length);
+
+/**
+ * @brief Get the room at a grid position
+ * 
+ * @param map The map to look in
+ * @param x The x coordinate of the chunk
+ * @param y The y coordinate of the chunk
+ * @return EnvironmentChunk* The room, or NULL if there is none or the position is outside the grid
+ */
+EnvironmentChunk* Map_GetChunk(const EnvironmentMap* map, int x, int y);
+
+/**
+ * @brief Get the room at a grid position, taking one from the pool if there is none yet
+ * 
+ * @param map The map to add to
+ * @param x The x coordinate of the chunk
+ * @param y The y coordinate of the chunk
+ * @return EnvironmentChunk* The room, or NULL if the position is outside the grid or the pool is full
+ */
+EnvironmentChunk* Map_AddChunk(EnvironmentMap* map, int x, int y);
+
 /**
  * @brief Set the starting chunk of the map
  * 
+ * @param map The map being generated
  * @param x The x coordinate of the chunk
  * @param y The y coordinate of the chunk
  */
-void Map_SetStartChunk(int x, int y);
+void Map_SetStartChunk(EnvironmentMap* map, int x, int y);
 
 /**
  * @brief Set the ending chunk of the map
  * 
+ * @param map The map being generated
  * @param x The x coordinate of the chunk
  * @param y The y coordinate of the chunk
  */
-void Map_SetEndChunk(int x, int y);
+void Map_SetEndChunk(EnvironmentMap* map, int x, int y);
 
 /**
  * @brief Create the main path through the map
+ * 
+ * @param map The map being generated
+ */
+void Map_CreateMainPath(EnvironmentMap* map);
+
+/**
+ * @brief Check if a position is on the main path of a map
+ * 
+ * @param map The map to check
+ * @param position Grid position of the chunk
+ * @return bool True if the position is on the main path
  */
-void Map_CreateMainPath();
+bool Map_IsOnMainPath(const EnvironmentMap* map, Vec2 position);
 
 /**
  * @brief Get the hallways configuration for a specific chunk
  * 
- * @param chunk The chunk to get hallways for
- * @param map The map containing the chunk
+ * @param chunk Pointer to the chunk to get hallways for
+ * @param map Pointer to the map containing the chunk
  * @return RoomHallways The hallways configuration for the chunk
  */
-RoomHallways Map_GetChunkHallways(EnvironmentChunk chunk, EnvironmentMap map);
\ No newline at end of file
+RoomHallways Map_GetChunkHallways(const EnvironmentChunk* chunk, const EnvironmentMap* map);
\ No newline at end of file
@@ -74,13 +74,35 @@ typedef enum{
 } TileRotation;
 
 /**
- * @struct EnvironmentTile
- * @brief Represents a single environment tile
+ * @brief Represents a single environment tile, packed into one byte
+ * 
+ * The low TILE_TYPE_BITS bits hold the TileType and the bits above them
+ * the TileRotation. The texture is looked up from the type when the tile
+ * is drawn, so a chunk of tiles stays small enough to stay in cache.
+ * Build tiles with Tile_Create() and read them with TILE_GET_TYPE() and
+ * TILE_GET_ROTATION().
  */
-typedef struct {
-    SDL_Texture* texture;       /**< Texture for this tile */
-    TileRotation rotation;      /**< Rotation applied to this tile */
-} EnvironmentTile;
+typedef Uint8 EnvironmentTile;
+
+/**
+ * @def TILE_TYPE_BITS
+ * @brief Number of low bits of an EnvironmentTile holding its TileType
+ */
+#define TILE_TYPE_BITS 4
+
+/**
+ * @def TILE_GET_TYPE(tile)
+ * @brief Reads the TileType of a packed tile
+ */
+#define TILE_GET_TYPE(tile) ((TileType) ((tile) & ((1 << TILE_TYPE_BITS) - 1)))
+
+/**
+ * @def TILE_GET_ROTATION(tile)
+ * @brief Reads the TileRotation of a packed tile
+ */
+#define TILE_GET_ROTATION(tile) ((TileRotation) ((tile) >> TILE_TYPE_BITS))
+
+_Static_assert(TILE_TYPE_COUNT <= (1 << TILE_TYPE_BITS), "TileType no longer fits in an EnvironmentTile");
 
 /**
  * @struct EnvironmentTileResources
@@ -110,6 +132,11 @@ typedef struct {
 /** Global tile data instance */
 extern EnvironmentTileData tiles;
 
+/**
+ * @brief Queues every tile texture for the startup asset loader
+ */
+void Tile_QueueAssets();
+
 /**
  * @brief Initialize tile system
  */
@@ -123,12 +150,6 @@ void Tile_Start();
  */
 EnvironmentTile Tile_Create(TileType type, TileRotation rotation);
 
-/**
- * @brief Destroy a tile and free resources
- * @param tile Pointer to the tile to destroy
- */
-void Tile_Destroy(EnvironmentTile* tile);
-
 /**
  * @brief Render a tile at the specified position
  * @param tile The tile to render
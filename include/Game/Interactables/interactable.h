@@ -6,6 +6,7 @@
 #include <gun.h>
 #include <UI_text.h>
 #include <app.h>
+#include <sprite_atlas.h>
 
 #define MAX_INTERACTABLES 100
 
@@ -64,12 +65,13 @@ extern HealthData healthData[3];
 extern AbilityData abilityData[8];
 extern Interactable interactables[MAX_INTERACTABLES];
 extern Interactable interactableData[INTERACTABLE_COUNT];
-extern SDL_Texture* interactabletextures[INTERACTABLE_COUNT];
+extern SpriteRegion interactableSprites[INTERACTABLE_COUNT];
 
 int Interactable_Create(InteractableType type, Vec2 position);
 void Interactable_CreateWeapon(Gun gun, Vec2 position);
 void Interactable_CreateWeaponCrate(bool opened, Gun gun, Vec2 position);
 void Interactable_CreateLog(int logIndex, Vec2 position);
+void Interactable_QueueAssets();
 void Interactable_Start();
 void Interactable_Update();
 void Interactable_Render();
@@ -3,5 +3,7 @@
 #include <vec2.h>
 #include <app.h>
 
+void Log_QueueAssets();
 void Log_Start();
+void Log_Quit();
 void Log_Render();
\ No newline at end of file
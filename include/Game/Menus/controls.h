@@ -12,12 +12,22 @@
 
 extern AppScene controlLastScene;
 
+/**
+ * @brief Queues the controls background for the startup asset loader
+ */
+void Controls_QueueAssets();
+
 /**
  * @brief Initializes the controls screen
  * Loads textures and UI elements needed for the controls screen
  */
 void Controls_Start();
 
+/**
+ * @brief Releases the textures of the controls screen
+ */
+void Controls_Quit();
+
 /**
  * @brief Updates the controls screen state
  * Handles input and interaction with the controls screen
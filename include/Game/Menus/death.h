@@ -10,6 +10,11 @@
 
 #include <app.h>
 
+/**
+ * @brief Queues the images of the death screen for the startup asset loader
+ */
+void Death_QueueAssets();
+
 /**
  * @brief Initializes the death screen
  * 
@@ -17,6 +22,11 @@
  */
 void Death_Start();
 
+/**
+ * @brief Releases the textures of the death screen
+ */
+void Death_Quit();
+
 /**
  * @brief Updates the death screen state
  * 
@@ -2,6 +2,8 @@
 
 #include <player.h>
 
+void HUD_QueueAssets();
 void HUD_Start();
+void HUD_Quit();
 void HUD_Render();
 void HUD_Update();
\ No newline at end of file
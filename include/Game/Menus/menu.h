@@ -8,6 +8,11 @@
 
 #pragma once
 
+/**
+ * @brief Queues the menu images for the startup asset loader.
+ */
+void Menu_QueueAssets();
+
 /**
  * @brief Prepares and loads all menu textures.
  * 
@@ -15,6 +20,11 @@
  */
 void Menu_PrepareTextures();
 
+/**
+ * @brief Releases the menu textures.
+ */
+void Menu_Quit();
+
 /**
  * @brief Updates the menu state based on user input.
  * 
@@ -22,9 +22,6 @@
 /** @brief Size of hallways on the minimap in pixels */
 #define MINIMAP_CHUNK_HALLWAY_SIZE 2
 
-/** @brief Margin around the minimap */
-#define MINIMAP_MARGIN ((MINIMAP_SIZE - (MINIMAP_CHUNK_SIZE * MAP_SIZE_CHUNK)))
-
 /** @brief Color for regular rooms (R,G,B,A) */
 #define MINIMAP_ROOM_COLOR 255, 255, 255, 255
 
@@ -46,6 +43,11 @@
 /** @brief Position and size of the minimap on screen */
 extern SDL_Rect minimapPosition;
 
+/**
+ * @brief Queues the minimap images for the startup asset loader
+ */
+void Minimap_QueueAssets();
+
 /**
  * @brief Initialize the minimap system
  * 
@@ -53,11 +55,21 @@ extern SDL_Rect minimapPosition;
  */
 void Minimap_Start();
 
+/**
+ * @brief Frees the minimap textures
+ */
+void Minimap_Quit();
+
 /**
  * @brief Render the complete minimap to the screen
  */
 void Minimap_Render();
 
+/**
+ * @brief Mark the cached minimap layer for a redraw
+ */
+void Minimap_Invalidate();
+
 /**
  * @brief Render a specific chunk on the minimap
  * @param chunk Pointer to the environment chunk to render
@@ -93,7 +105,7 @@ SDL_Color Minimap_GetRoomColor(EnvironmentChunk *chunk);
 /**
  * @brief Calculate the position of a chunk on the minimap
  * @param chunk Pointer to the chunk
- * @return Vec2 Position coordinates on the minimap
+ * @return Vec2 Position coordinates relative to the top left of the minimap
  */
 Vec2 Minimap_GetMinimapChunkPosition(EnvironmentChunk *chunk);
 
@@ -3,6 +3,8 @@
 #include <SDL.h>
 #include <SDL_image.h>
 
+void Mission_QueueAssets();
 void Mission_Start();
+void Mission_Quit();
 void Mission_Update();
 void Mission_Render();
\ No newline at end of file
@@ -3,7 +3,7 @@
 #include <app.h>
 
 // Current settings version - increment this when adding new settings
-#define SETTINGS_VERSION 1
+#define SETTINGS_VERSION 2
 
 extern AppScene settingsLastScene;
 
@@ -32,6 +32,8 @@ bool Settings_GetDebugMode();
 bool Settings_GetScreenShake();
 bool Settings_GetCameraSmoothing();
 bool Settings_GetHideParticles();
+bool Settings_GetVSync();
+int Settings_GetFPSCap();
 
 // Function to save settings
 void Settings_Save();
@@ -3,6 +3,11 @@
 #include <app.h>
 #include <death.h>  // For access to EndScreen functions
 
+/**
+ * @brief Queues the images of the win screen for the startup asset loader
+ */
+void Win_QueueAssets();
+
 /**
  * @brief Initializes the win screen
  * 
@@ -10,6 +15,11 @@
  */
 void Win_Start();
 
+/**
+ * @brief Releases the textures of the win screen
+ */
+void Win_Quit();
+
 /**
  * @brief Updates the win screen state
  * 
@@ -4,6 +4,7 @@
 
 typedef struct {
     int currentStage;
+    Uint64 seed; /**< Seed of the current run, every stage's map is generated from it */
     bool isTransitioning;
     Timer* transitionTimer;
 
@@ -20,6 +21,7 @@ extern GameData game;
 void Game_Start();
 void Game_Update();
 void Game_Restart();
+Uint64 Game_GetStageSeed(int stage);
 void Game_TransitionNextLevel(void* data, int interactableIndex);
 void Game_QueueNextMusic();
 void Game_PlayCurrentMusic();
@@ -29,4 +31,7 @@ void Player_PickUpSkill(void* data, int interactableIndex);
 void Game_AddAmmoSpent(int ammo);
 void Game_AddHitsTaken();
 void Game_AddHealingItemUsed();
+void Game_SaveInterpolationState();
+void Game_ApplyInterpolation();
+void Game_RestoreInterpolation();
 
@@ -179,6 +179,11 @@ void Gun_AnimationUpdate();
  */
 void Gun_Render();
 
+/**
+ * @brief Queues the spritesheet of every gun for the startup asset loader
+ */
+void Gun_QueueAssets();
+
 /**
  * @brief Initializes gun systems
  */
@@ -162,6 +162,11 @@ void Player_Input_Handler();
  */
 int Player_Render();
 
+/**
+ * @brief Queues the player's images for the startup asset loader
+ */
+void Player_QueueAssets();
+
 /**
  * @brief Initializes the player
  * @return Status code
@@ -54,6 +54,12 @@
 #include <camera.h>
 #include <colliders.h>
 
+/**
+ * @def PARTICLE_RANDOM_BATCH
+ * @brief Random angles drawn at once when emitting a burst of particles
+ */
+#define PARTICLE_RANDOM_BATCH 64
+
 /**
  * @brief A struct that represents a particle.
  *
@@ -161,6 +167,13 @@ void ParticleEmitter_SetMaxParticles(ParticleEmitter* emitter, int maxParticles)
  */
 void ParticleEmitter_Emit(ParticleEmitter* emitter);
 
+/**
+ * @brief Emits several particles, drawing their random angles in bulk.
+ * @param emitter The emitter to emit particles from.
+ * @param count The number of particles to emit.
+ */
+void ParticleEmitter_EmitBurst(ParticleEmitter* emitter, int count);
+
 /**
  * @brief Gets the next available particle index.
  * @param emitter The emitter to get the next available particle index from.
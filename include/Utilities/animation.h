@@ -81,7 +81,8 @@ typedef struct AnimationClipData {
  * @brief The main animation structure.
  */
 typedef struct Animation {
-    SDL_Texture* spritesheet;  /**< Spritesheet texture */
+    SDL_Texture* spritesheet;  /**< Texture holding the spritesheet, usually a shared atlas page */
+    SDL_Rect sheetRect;        /**< Area of the spritesheet inside that texture */
     AnimationClip* clips;      /**< Array of different animations */
     int clipCount;             /**< Number of animation clips */
     
@@ -0,0 +1,68 @@
+/**
+ * @file asset_archive.h
+ * @brief Serves asset files out of the packed archive
+ *
+ * The build packs the Assets folder into ASSET_ARCHIVE_PATH (see
+ * tools/asset_packer.c and asset_archive_format.h). At startup the archive
+ * is memory mapped once, and every image, sound, music and font is opened
+ * as an SDL_RWops reading straight from the mapping, instead of opening,
+ * reading and closing a loose file each time.
+ *
+ * Without an archive, or for a path it does not hold, files are opened from
+ * the disk as before, so the game still runs from a plain Assets folder.
+ *
+ * Lookups only read the index, so the asset loader's workers can open
+ * files while the archive is open.
+ *
+ * @section archive_usage Usage
+ * ```c
+ * SDL_Texture* title = IMG_LoadTexture_RW(renderer, AssetArchive_OpenFile("Assets/Images/title.png"), 1);
+ * ```
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <stdbool.h>
+
+/**
+ * @brief Archive the game looks for next to the executable
+ */
+#define ASSET_ARCHIVE_PATH "Assets.pak"
+
+/**
+ * @brief Maps an asset archive and checks its index
+ *
+ * A missing or invalid archive is logged and files are read from the disk.
+ *
+ * @param path Path of the archive
+ * @return int Status code (0 if the archive is open, non-zero if files come from the disk)
+ */
+int AssetArchive_Open(const char* path);
+
+/**
+ * @brief Opens an asset file for reading
+ *
+ * @param path Path of the file, like "Assets/Images/title.png"
+ * @return SDL_RWops* A read only view of the archive if it holds the path, otherwise the file
+ *         on disk, NULL if neither exists. Pass it to the *_RW loaders with freesrc set.
+ */
+SDL_RWops* AssetArchive_OpenFile(const char* path);
+
+/**
+ * @brief Checks whether files are served from an archive
+ *
+ * @return bool True if an archive is open
+ */
+bool AssetArchive_IsOpen();
+
+/**
+ * @brief Unmaps the archive
+ *
+ * Music and fonts keep reading their RWops while they are in use, so this
+ * runs after they are freed.
+ */
+void AssetArchive_Close();
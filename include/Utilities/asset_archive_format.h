@@ -0,0 +1,73 @@
+/**
+ * @file asset_archive_format.h
+ * @brief Layout of the packed asset archive, shared by the game and the packer
+ *
+ * Kept free of SDL so tools/asset_packer.c can build without it.
+ * All integers are little endian.
+ * ```
+ * AssetArchiveHeader
+ * AssetArchiveEntry[entryCount]   sorted by hash, then path
+ * path strings                    not terminated, see pathOffset and pathLength
+ * file data                       each file starts on ASSET_ARCHIVE_ALIGNMENT
+ * ```
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Identifies asset archives, "ONMP" read as a little endian integer
+ */
+#define ASSET_ARCHIVE_MAGIC 0x504D4E4F
+
+/**
+ * @brief Version of the archive layout, bumped on any change
+ */
+#define ASSET_ARCHIVE_VERSION 1
+
+/**
+ * @brief Alignment of every file's data inside the archive
+ */
+#define ASSET_ARCHIVE_ALIGNMENT 16
+
+/**
+ * @brief Start of the archive
+ */
+typedef struct AssetArchiveHeader {
+    uint32_t magic;         /**< ASSET_ARCHIVE_MAGIC */
+    uint32_t version;       /**< ASSET_ARCHIVE_VERSION */
+    uint32_t entryCount;    /**< Number of files */
+    uint32_t reserved;      /**< Zero */
+} AssetArchiveHeader;
+
+/**
+ * @brief Index entry of one packed file
+ */
+typedef struct AssetArchiveEntry {
+    uint32_t hash;          /**< AssetArchive_Hash() of the path */
+    uint32_t pathOffset;    /**< Where the path is, from the start of the archive */
+    uint32_t pathLength;    /**< Length of the path in bytes */
+    uint32_t reserved;      /**< Zero */
+    uint64_t offset;        /**< Where the file data is, from the start of the archive */
+    uint64_t size;          /**< Size of the file in bytes */
+} AssetArchiveEntry;
+
+/**
+ * @brief Hashes a path the way the index is sorted (FNV-1a)
+ *
+ * @param path The path, with forward slashes, like "Assets/Images/title.png"
+ * @param length Bytes of the path to hash
+ * @return uint32_t The hash
+ */
+static inline uint32_t AssetArchive_Hash(const char* path, uint32_t length) {
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < length; i++) {
+        hash ^= (uint8_t) path[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
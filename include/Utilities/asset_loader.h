@@ -0,0 +1,68 @@
+/**
+ * @file asset_loader.h
+ * @brief Decodes the startup assets on a pool of worker threads
+ *
+ * Reading and decoding PNG and WAV files is most of the startup time, and
+ * none of it needs the renderer. Paths are queued first, then
+ * AssetLoader_Run() decodes images to SDL_Surface and sounds to Mix_Chunk
+ * on ASSET_LOADER_MAX_THREADS threads at most, while the main thread draws
+ * a progress bar. The decoded images go to the asset cache (see assets.h),
+ * and the textures are created on the main thread when the modules that
+ * use them start, as before.
+ *
+ * Anything not queued is still loaded the first time it is asked for, so a
+ * missing path only costs time.
+ *
+ * @section loader_usage Usage
+ * ```c
+ * AssetLoader_QueueImage("Assets/Images/title.png");
+ * AssetLoader_QueueSound("Assets/Audio/SoundEffect/dash.wav", &dashSound);
+ * AssetLoader_Run();
+ *
+ * title = Assets_LoadTexture("Assets/Images/title.png"); // no decoding left
+ * ```
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+/**
+ * @brief Most assets that can be queued for one run
+ */
+#define ASSET_LOADER_MAX_JOBS 256
+
+/**
+ * @brief Most worker threads, fewer are used on machines with fewer cores
+ */
+#define ASSET_LOADER_MAX_THREADS 8
+
+/**
+ * @brief Queues an image to decode, skipped if the path is already queued
+ *
+ * @param path Path of the image file, copied
+ */
+void AssetLoader_QueueImage(const char* path);
+
+/**
+ * @brief Queues a sound to decode
+ *
+ * The audio device must be open before the loader runs.
+ *
+ * @param path Path of the sound file, copied
+ * @param out Receives the sound, left untouched if it fails to load
+ */
+void AssetLoader_QueueSound(const char* path, Mix_Chunk** out);
+
+/**
+ * @brief Decodes every queued asset on the worker threads and empties the queue
+ *
+ * Draws a progress bar until the workers are done, except in headless runs.
+ *
+ * @return int Number of assets that failed to load
+ */
+int AssetLoader_Run();
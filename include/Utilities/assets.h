@@ -0,0 +1,106 @@
+/**
+ * @file assets.h
+ * @brief Shared, reference counted cache of standalone textures keyed by path
+ *
+ * Every image drawn as its own texture (backgrounds, icons, the cursor, ...)
+ * is loaded through the asset manager, so each path is only read from disk
+ * once however many modules ask for it. Each module releases the textures
+ * it loaded when it quits, which makes forgotten references show up in
+ * the log when the cache is destroyed. Loading a path that is already in
+ * the cache is a hash lookup, which makes it safe during gameplay.
+ * Sprites that are drawn in batches go through the sprite atlas instead
+ * (see sprite_atlas.h).
+ *
+ * The cache also keeps track of how much texture memory it holds.
+ *
+ * Images decoded ahead of time by the startup loader (see asset_loader.h)
+ * wait in the cache as surfaces. Loading them only uploads the texture, and
+ * Assets_LoadSurface() hands them to code that uploads its own, like the
+ * sprite atlas.
+ *
+ * @section assets_usage Usage
+ * ```c
+ * SDL_Texture* icon = Assets_LoadTexture("Assets/Images/Icons/health.png");
+ * SDL_RenderCopy(renderer, icon, NULL, &dest);
+ *
+ * // Once the texture is not needed anymore, it is destroyed with its last reference
+ * Assets_ReleaseTexture(icon);
+ * ```
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * @brief Maximum number of different paths the cache can hold
+ */
+#define ASSETS_MAX_TEXTURES 128
+
+/**
+ * @brief Size of the hash index, a power of two larger than ASSETS_MAX_TEXTURES
+ */
+#define ASSETS_HASH_BUCKETS 256
+
+/**
+ * @brief Loads a texture, or returns the one already loaded from the same path
+ *
+ * Every call takes a reference, released with Assets_ReleaseTexture().
+ *
+ * @param path Path of the image file
+ * @return SDL_Texture* The texture, NULL if it could not be loaded
+ */
+SDL_Texture* Assets_LoadTexture(const char* path);
+
+/**
+ * @brief Gets the decoded pixels of an image, in SDL_PIXELFORMAT_RGBA32
+ *
+ * Returns the surface the startup loader decoded for the path if there is
+ * one, otherwise decodes the file now.
+ *
+ * @param path Path of the image file
+ * @return SDL_Surface* The surface, owned by the caller, NULL if it could not be loaded
+ */
+SDL_Surface* Assets_LoadSurface(const char* path);
+
+/**
+ * @brief Keeps a decoded image until Assets_LoadTexture() or Assets_LoadSurface() asks for its path
+ *
+ * Main thread only, the loader calls it once its workers are done.
+ *
+ * @param path Path the image was decoded from
+ * @param surface The decoded image, the cache takes ownership
+ */
+void Assets_AddSurface(const char* path, SDL_Surface* surface);
+
+/**
+ * @brief Frees the decoded images nothing asked for
+ */
+void Assets_FreeSurfaces();
+
+/**
+ * @brief Gives back a reference taken by Assets_LoadTexture(), destroying the texture with the last one
+ *
+ * @param texture The texture, NULL is ignored
+ */
+void Assets_ReleaseTexture(SDL_Texture* texture);
+
+/**
+ * @brief Gets the memory held by the cached textures
+ *
+ * @return size_t Bytes of pixel data, estimated from the texture sizes and formats
+ */
+size_t Assets_GetTextureMemory();
+
+/**
+ * @brief Logs how many textures are cached and the memory they use
+ */
+void Assets_LogUsage();
+
+/**
+ * @brief Destroys every cached texture, logging those still referenced
+ */
+void Assets_Destroy();
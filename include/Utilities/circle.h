@@ -3,6 +3,11 @@
 #include <SDL.h>
 #include <vec2.h>
 
+/**
+ * @brief Maximum number of distinct shape textures kept by the shape cache
+ */
+#define SHAPE_CACHE_SIZE 32
+
 void DrawFilledCircle(Vec2 center, int radius, SDL_Color color);
 bool IsRectOverlappingCircle(SDL_Rect rect, Vec2 circleCenter, float radius);
 SDL_Texture* CreateCircleTexture(int radius, SDL_Color color);
@@ -11,4 +16,8 @@ SDL_Texture* CreateCircleOutlineTexture(int radius, SDL_Color color, int thickne
 SDL_Texture* CreateHalfCircleOutlineTexture(int radius, Vec2 direction, SDL_Color color, int thickness);
 
 void DrawFilledHalfCircle(Vec2 center, int radius, Vec2 direction, SDL_Color color);
-SDL_Texture* CreateHalfCircleTexture(int radius, Vec2 direction, SDL_Color color);
\ No newline at end of file
+SDL_Texture* CreateHalfCircleTexture(int radius, Vec2 direction, SDL_Color color);
+
+SDL_Texture* GetCachedCircleTexture(int radius, SDL_Color color, int thickness);
+SDL_Texture* GetCachedHalfCircleTexture(int radius, SDL_Color color, int thickness);
+void ClearShapeCache();
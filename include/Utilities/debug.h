@@ -32,4 +32,9 @@ void Debug_RenderSpikeCount();
 /**
  * @brief Renders information about the current chunk.
  */
-void Debug_RenderCurrentChunk();
\ No newline at end of file
+void Debug_RenderCurrentChunk();
+
+/**
+ * @brief Renders the number of allocations made during the last frame.
+ */
+void Debug_RenderAllocationCount();
\ No newline at end of file
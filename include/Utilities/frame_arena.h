@@ -0,0 +1,74 @@
+/**
+ * @file frame_arena.h
+ * @brief Bump allocator for memory that only lives until the end of the frame
+ *
+ * Allocations are carved out of one static block by moving an offset, and
+ * the whole block is given back at once by FrameArena_Reset() at the start
+ * of every frame (see App_PreUpdate()). Nothing is freed individually.
+ *
+ * Use it for scratch data built and used within a frame, like formatted
+ * strings and paths. Anything kept across frames still needs malloc.
+ *
+ * When the block is full, allocations fall back to malloc and are freed on
+ * the next reset, so a busy frame is slower but never fails.
+ *
+ * @section arena_usage Usage
+ * ```c
+ * char* path = FrameArena_Alloc(100);
+ * snprintf(path, 100, "Assets/Audio/Music/%s.wav", name);
+ * Sound_Play_Music(path, 0);   // No free, the memory is reused next frame
+ * ```
+ *
+ * @author Mango
+ * @date 2025-04-17
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <stddef.h>
+
+/**
+ * @brief Size of the static block in bytes
+ */
+#define FRAME_ARENA_CAPACITY (64 * 1024)
+
+/**
+ * @brief Alignment of every allocation, enough for any built-in type
+ */
+#define FRAME_ARENA_ALIGNMENT 16
+
+/**
+ * @brief Usage of the arena over one frame
+ */
+typedef struct FrameArenaStats {
+    int allocations;        /**< Allocations made */
+    int overflowAllocations; /**< Allocations that did not fit and went to malloc */
+    size_t bytesUsed;       /**< Bytes handed out from the block */
+    size_t peakBytesUsed;   /**< Most bytes used by any frame so far */
+} FrameArenaStats;
+
+/**
+ * @brief Allocates memory that stays valid until the next FrameArena_Reset()
+ * @param size Number of bytes
+ * @return void* The memory, or NULL if size is 0 or the fallback malloc failed
+ */
+void* FrameArena_Alloc(size_t size);
+
+/**
+ * @brief Copies a string into the arena
+ * @param text The string to copy
+ * @return char* The copy, valid until the next FrameArena_Reset()
+ */
+char* FrameArena_Strdup(const char* text);
+
+/**
+ * @brief Gives back everything allocated since the last reset
+ */
+void FrameArena_Reset();
+
+/**
+ * @brief Returns how the arena was used during the previous frame
+ * @return FrameArenaStats The usage recorded by the last FrameArena_Reset()
+ */
+FrameArenaStats FrameArena_GetLastFrameStats();
@@ -1,6 +1,13 @@
+#pragma once
+
 #include <vec2.h>
 #include <SDL.h>
 
+/**
+ * @brief Beams queued before the beam batch is flushed on its own
+ */
+#define LAZER_BATCH_MAX_BEAMS 128
+
 typedef struct Lazer {
     bool active;
     Vec2 startPosition;
@@ -22,10 +29,22 @@ typedef struct Lazer {
 void Lazer_Update(Lazer* lazer);
 
 /**
- * @brief Renders a lazer with a glowing effect
+ * @brief Queues a lazer for the next Lazer_FlushBeams()
  *
- * @param startPosition The starting position of the lazer
- * @param endPosition The ending position of the lazer
- * @param width The width of the lazer
+ * @param lazer The lazer to render
+ */
+void Lazer_Render(Lazer* lazer);
+
+/**
+ * @brief Queues a beam with a red glow and a white core
+ *
+ * @param startPosition The starting position of the beam in world coordinates
+ * @param endPosition The ending position of the beam in world coordinates
+ * @param width The glow radius around the core, 0 for a thin red line
+ */
+void Lazer_DrawBeam(Vec2 startPosition, Vec2 endPosition, int width);
+
+/**
+ * @brief Draws every queued beam in one SDL_RenderGeometry call
  */
-void Lazer_Render(Lazer* lazer);
\ No newline at end of file
+void Lazer_FlushBeams();
\ No newline at end of file
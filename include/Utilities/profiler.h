@@ -0,0 +1,166 @@
+/**
+ * @file profiler.h
+ * @brief Scoped timing zones with an in-game overlay and Chrome trace export
+ *
+ * Zones are opened and closed around the code to measure and may nest.
+ * Every zone of a frame is stored as a sample in a ring buffer holding the
+ * last PROFILER_HISTORY_FRAMES frames. Samples are only recorded while
+ * debug mode is on or a trace was requested with --profile-trace, so the
+ * zones only cost a branch otherwise. Building with PROFILER_DISABLED
+ * defined removes them completely.
+ *
+ * Frames also carry counters (colliders, particles, textures created, ...)
+ * so a slow frame can be matched with what happened in it.
+ *
+ * In debug mode the overlay shows a bar per frame and the most expensive
+ * zones, and F9 writes the buffered frames to PROFILER_TRACE_PATH. The
+ * file opens in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * With --spike-capture MS, every frame is recorded and a frame taking
+ * longer than MS milliseconds writes the last PROFILER_SPIKE_WINDOW_FRAMES
+ * frames to its own PROFILER_SPIKE_PATH_FORMAT file, so hitches can be
+ * looked at after the run.
+ *
+ * @section profiler_usage Usage
+ * ```c
+ * // Around a call, named after the call itself
+ * PROFILE_CALL(Enemy_Update());
+ *
+ * // Around a block, the name must be a string that outlives the frame
+ * PROFILER_ZONE_BEGIN("Collisions");
+ * for (int i = 0; i < count; i++) Collider_Check(...);
+ * PROFILER_ZONE_END();
+ * ```
+ *
+ * @author Mango
+ * @date 2025-04-16
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <stdbool.h>
+
+/**
+ * @brief Number of past frames kept in the ring buffer
+ */
+#define PROFILER_HISTORY_FRAMES 240
+
+/**
+ * @brief Zones recorded per frame, later zones of the frame are dropped
+ *
+ * A frame can run several simulation steps, each opening its own zones.
+ */
+#define PROFILER_MAX_SAMPLES_PER_FRAME 256
+
+/**
+ * @brief Deepest zone nesting that is tracked
+ */
+#define PROFILER_MAX_DEPTH 16
+
+/**
+ * @brief File written when a trace is exported with F9
+ */
+#define PROFILER_TRACE_PATH "profile_trace.json"
+
+/**
+ * @brief Frames written for each spike, the spike being the last one
+ */
+#define PROFILER_SPIKE_WINDOW_FRAMES 60
+
+/**
+ * @brief File name of each spike capture, numbered from 1
+ */
+#define PROFILER_SPIKE_PATH_FORMAT "spike_%03d.json"
+
+/**
+ * @brief Spike captures written in one run at most
+ */
+#define PROFILER_SPIKE_MAX_CAPTURES 32
+
+/**
+ * @brief Frames after a capture during which further spikes are not written
+ *
+ * A hitch often slows a few frames in a row, one file covers them all.
+ */
+#define PROFILER_SPIKE_COOLDOWN_FRAMES PROFILER_SPIKE_WINDOW_FRAMES
+
+/**
+ * @brief What happened during a frame, besides the time it took
+ */
+typedef enum {
+    PROFILER_COUNTER_COLLIDERS,         /**< Registered colliders at the end of the frame */
+    PROFILER_COUNTER_ENEMIES,           /**< Live enemies at the end of the frame */
+    PROFILER_COUNTER_PARTICLES_UPDATED, /**< Live particles moved, over every simulation step */
+    PROFILER_COUNTER_TEXTURES_CREATED,  /**< Textures created, loaded or uploaded into the sprite atlas during the frame */
+    PROFILER_COUNTER_TEXTS_RASTERIZED,  /**< Strings rendered with SDL_ttf during the frame */
+    PROFILER_COUNTER_HEAP_ALLOCATIONS,  /**< malloc calls at the tracked runtime sites (timers, UI text, colliders, ...) */
+    PROFILER_COUNTER_ARENA_ALLOCATIONS, /**< Allocations from the frame arena (see frame_arena.h) */
+    PROFILER_COUNTER_COUNT
+} ProfilerCounter;
+
+#ifdef PROFILER_DISABLED
+#define PROFILER_ZONE_BEGIN(name) ((void) 0)
+#define PROFILER_ZONE_END() ((void) 0)
+#define PROFILE_CALL(call) call
+#define PROFILER_COUNT(counter, amount) ((void) 0)
+#else
+#define PROFILER_ZONE_BEGIN(name) Profiler_BeginZone(name)
+#define PROFILER_ZONE_END() Profiler_EndZone()
+#define PROFILE_CALL(call) do { Profiler_BeginZone(#call); call; Profiler_EndZone(); } while (0)
+#define PROFILER_COUNT(counter, amount) Profiler_Count(counter, amount)
+#endif
+
+/**
+ * @brief Starts a new frame in the ring buffer
+ * @param record Whether zones of this frame should be recorded
+ */
+void Profiler_BeginFrame(bool record);
+
+/**
+ * @brief Closes the current frame, and writes a spike capture if it was too slow
+ */
+void Profiler_EndFrame();
+
+/**
+ * @brief Opens a zone, use PROFILER_ZONE_BEGIN() instead
+ * @param name Name of the zone, must stay valid while the frame is in the buffer
+ */
+void Profiler_BeginZone(const char* name);
+
+/**
+ * @brief Closes the most recently opened zone, use PROFILER_ZONE_END() instead
+ */
+void Profiler_EndZone();
+
+/**
+ * @brief Adds to a counter of the current frame, use PROFILER_COUNT() instead
+ * @param counter The counter to add to
+ * @param amount The amount to add
+ */
+void Profiler_Count(ProfilerCounter counter, int amount);
+
+/**
+ * @brief Returns a counter of the last closed frame
+ * @param counter The counter to read
+ * @return int Its value, 0 if that frame was not recorded
+ */
+int Profiler_GetLastFrameCounter(ProfilerCounter counter);
+
+/**
+ * @brief Returns the number of spike captures written so far
+ * @return int Number of files written
+ */
+int Profiler_GetSpikeCaptureCount();
+
+/**
+ * @brief Draws the frame time bar graph and the most expensive zones
+ */
+void Profiler_RenderOverlay();
+
+/**
+ * @brief Writes every buffered frame as Chrome trace-event JSON
+ * @param path The file to write
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int Profiler_ExportTrace(const char* path);
@@ -2,9 +2,14 @@
  * @file random.h
  * @brief Provides random number generation functionality for integers, floats, and boolean values.
  *
- * These functions can be used to generate random integers and floats.
- * To use these functions, call RandomInit() once at the start of the program.
- * Then, call RandInt() or RandFloat() to get random numbers.
+ * Every generator is a PCG32 RandomState, so the same seed always gives the
+ * same numbers. The game draws from a few independent streams, one per
+ * system, so that adding a particle never changes what the AI or the loot
+ * rolls next. Call RandomInit() with a seed before using them.
+ * RandInt(), RandFloat() and RandBool() draw from RANDOM_STREAM_GENERAL.
+ *
+ * Code that runs off the main thread, like the map worker, uses its own
+ * RandomState instead of the shared streams.
  *
  * @author Mango
  * @date 2025-03-03
@@ -12,15 +17,37 @@
 
 #pragma once
 #include <stdlib.h>
-#include <time.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief State of an independent PCG32 generator
+ */
+typedef struct RandomState {
+    uint64_t state;     /**< Current position in the sequence */
+    uint64_t increment; /**< Selects the sequence, always odd */
+} RandomState;
+
+/**
+ * @brief Shared generators, one per system
+ */
+typedef enum RandomStream {
+    RANDOM_STREAM_GENERAL,    /**< Anything without a stream of its own */
+    RANDOM_STREAM_MAP,        /**< Sequence of the maps' own generators (see EnvironmentMap.random), nothing draws from the shared stream */
+    RANDOM_STREAM_AI,         /**< Enemy decisions and spawns */
+    RANDOM_STREAM_PARTICLES,  /**< Particle emission and movement */
+    RANDOM_STREAM_LOOT,       /**< Item drops */
+    RANDOM_STREAM_COUNT       /**< Number of streams */
+} RandomStream;
 
 /**
- * @brief Initializes the random number generator.
+ * @brief Seeds every shared stream
  *
- * This function should be called once at the start of the program.
+ * Called once at the start of the program, and again when a run starts so
+ * the run only depends on its seed.
+ * @param seed The seed, each stream gets its own sequence from it
  */
-void RandomInit();
+void RandomInit(uint64_t seed);
 
 /**
  * @brief Generates a random integer between min and max (inclusive).
@@ -43,3 +70,86 @@ float RandFloat(float min, float max);
  * @return A random boolean value (true or false).
  */
 bool RandBool();
+
+/**
+ * @brief Gets the generator of a shared stream
+ * @param stream The stream
+ * @return RandomState* The generator, only to be used on the main thread
+ */
+RandomState* Random_GetStream(RandomStream stream);
+
+/**
+ * @brief Generates a random integer between min and max (inclusive) from a shared stream
+ * @param stream The stream to draw from
+ * @param min The minimum value.
+ * @param max The maximum value.
+ * @return A random integer between min and max.
+ */
+int Random_Int(RandomStream stream, int min, int max);
+
+/**
+ * @brief Generates a random float between min and max from a shared stream
+ * @param stream The stream to draw from
+ * @param min The minimum value.
+ * @param max The maximum value.
+ * @return A random float between min and max.
+ */
+float Random_Float(RandomStream stream, float min, float max);
+
+/**
+ * @brief Generates a random boolean value from a shared stream
+ * @param stream The stream to draw from
+ * @return A random boolean value (true or false).
+ */
+bool Random_Bool(RandomStream stream);
+
+/**
+ * @brief Seeds an independent generator, the same seed and sequence always give the same numbers
+ * @param random The generator to seed
+ * @param seed The seed
+ * @param sequence Selects one of 2^63 independent sequences, like a RandomStream
+ */
+void RandomState_Seed(RandomState* random, uint64_t seed, uint64_t sequence);
+
+/**
+ * @brief Generates the next 32 random bits of an independent generator
+ * @param random The generator
+ * @return uint32_t The random bits
+ */
+uint32_t RandomState_Next(RandomState* random);
+
+/**
+ * @brief Generates a random integer between min and max (inclusive) from an independent generator
+ * @param random The generator
+ * @param min The minimum value.
+ * @param max The maximum value.
+ * @return A random integer between min and max.
+ */
+int RandomState_Int(RandomState* random, int min, int max);
+
+/**
+ * @brief Generates a random float between min and max from an independent generator
+ * @param random The generator
+ * @param min The minimum value.
+ * @param max The maximum value.
+ * @return A random float between min and max.
+ */
+float RandomState_Float(RandomState* random, float min, float max);
+
+/**
+ * @brief Fills a buffer with random bits
+ * @param random The generator
+ * @param out The buffer to fill
+ * @param count Number of values to write
+ */
+void RandomState_Fill(RandomState* random, uint32_t* out, int count);
+
+/**
+ * @brief Fills a buffer with random floats between min and max
+ * @param random The generator
+ * @param out The buffer to fill
+ * @param count Number of values to write
+ * @param min The minimum value.
+ * @param max The maximum value.
+ */
+void RandomState_FillFloat(RandomState* random, float* out, int count, float min, float max);
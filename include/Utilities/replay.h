@@ -0,0 +1,114 @@
+/**
+ * @file replay.h
+ * @brief Records a play session's input to a file and plays it back headless
+ *
+ * With --record PATH, every frame's time, mouse position and input events
+ * are written to PATH, along with the seed, tick rate and key bindings of
+ * the session. The seed is fixed for the whole session so every run of it
+ * can be reproduced.
+ *
+ * With --replay PATH, the recording is fed back through the normal loop on
+ * an offscreen window (like --headless): real input is ignored, each frame
+ * gets the recorded events and frame time, so the same fixed steps run with
+ * the same input and random numbers. The frame timing report at the end
+ * gives percentiles per scene and stage.
+ *
+ * @section replay_format File format
+ * Little endian. A header, then one record per frame:
+ * ```
+ * header: u32 magic, u16 version, u16 tick rate, u32 seed, u32 frame count,
+ *         u16 binding count, u16 scancode per binding
+ * frame:  f64 frame seconds, f32 mouse x, f32 mouse y, u8 event count,
+ *         per event: u8 ReplayEventType, u8 repeat, u16 scancode or button
+ * ```
+ * Mouse motion is not stored as events, the frame's mouse position covers it.
+ *
+ * @section replay_usage Usage
+ * ```
+ * game --record boss.onmr      // play, then quit normally
+ * game --replay boss.onmr      // prints frame time percentiles and quits
+ * ```
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <stdbool.h>
+
+/**
+ * @brief Identifies replay files, "ONMR" read as a little endian integer
+ */
+#define REPLAY_MAGIC 0x524D4E4F
+
+/**
+ * @brief Version of the file format, bumped on any layout change
+ */
+#define REPLAY_VERSION 1
+
+/**
+ * @brief Input events stored per frame, later events of the frame are dropped
+ */
+#define REPLAY_MAX_EVENTS_PER_FRAME 32
+
+/**
+ * @brief Kinds of input events stored in a recording
+ */
+typedef enum ReplayEventType {
+    REPLAY_EVENT_KEY_DOWN,      /**< Code is a scancode */
+    REPLAY_EVENT_KEY_UP,        /**< Code is a scancode */
+    REPLAY_EVENT_MOUSE_DOWN,    /**< Code is an SDL mouse button */
+    REPLAY_EVENT_MOUSE_UP,      /**< Code is an SDL mouse button */
+    REPLAY_EVENT_WHEEL_UP,      /**< No code */
+    REPLAY_EVENT_WHEEL_DOWN     /**< No code */
+} ReplayEventType;
+
+/**
+ * @brief One stored input event
+ */
+typedef struct ReplayEvent {
+    Uint8 type;     /**< A ReplayEventType */
+    Uint8 repeat;   /**< Whether a key down is a key repeat */
+    Uint16 code;    /**< Scancode or mouse button */
+} ReplayEvent;
+
+/**
+ * @brief Opens the recording or the replay requested on the command line
+ *
+ * Must run before the seed, tick rate and window are set up: a replay
+ * overrides them with the recorded ones and makes the run headless.
+ *
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int Replay_Start();
+
+/**
+ * @brief Reads the next recorded frame and makes the time system use its frame time
+ */
+void Replay_PreUpdate();
+
+/**
+ * @brief Stores an input event of the frame being recorded
+ *
+ * @param event The SDL event, events that are not input are ignored
+ */
+void Replay_RecordEvent(const SDL_Event* event);
+
+/**
+ * @brief Ends the input of a frame: writes it when recording, applies the recorded one when replaying
+ */
+void Replay_EndInput();
+
+/**
+ * @brief Checks if a recording is being played back, in which case real input is ignored
+ *
+ * @return bool True while replaying
+ */
+bool Replay_IsPlaying();
+
+/**
+ * @brief Finishes the recording file or closes the replay
+ */
+void Replay_Quit();
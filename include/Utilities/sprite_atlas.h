@@ -0,0 +1,65 @@
+/**
+ * @file sprite_atlas.h
+ * @brief Runtime texture atlas that packs spritesheets into shared pages
+ *
+ * Images loaded through the atlas are copied into a few large textures
+ * instead of getting a texture each, so sprites from different sheets
+ * can be drawn in one SpriteBatch flush. Every path is only loaded once.
+ *
+ * @section atlas_usage Usage
+ * ```c
+ * SpriteRegion region;
+ * if (SpriteAtlas_Load("Assets/Images/Enemies/echo.png", &region)) return 1;
+ *
+ * // region.texture is the atlas page, region.rect is where the image is on it
+ * SDL_RenderCopy(renderer, region.texture, &region.rect, &dest);
+ * ```
+ *
+ * @author Mango
+ * @date 2025-04-14
+ */
+
+#pragma once
+
+#include <SDL.h>
+
+/**
+ * @brief Width and height of an atlas page in pixels
+ */
+#define SPRITE_ATLAS_PAGE_SIZE 2048
+
+/**
+ * @brief Maximum number of atlas pages
+ */
+#define SPRITE_ATLAS_MAX_PAGES 4
+
+/**
+ * @brief Maximum number of images the atlas can remember
+ */
+#define SPRITE_ATLAS_MAX_ENTRIES 128
+
+/**
+ * @brief Empty pixels kept between packed images
+ */
+#define SPRITE_ATLAS_PADDING 1
+
+/**
+ * @brief The area of a texture an image was packed into
+ */
+typedef struct SpriteRegion {
+    SDL_Texture* texture;   /**< The atlas page (or a standalone texture if it did not fit) */
+    SDL_Rect rect;          /**< Where the image is inside the texture */
+} SpriteRegion;
+
+/**
+ * @brief Loads an image into the atlas, or returns the region it was already loaded to
+ * @param path Path of the image file
+ * @param region Receives the texture and rect of the image
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int SpriteAtlas_Load(const char* path, SpriteRegion* region);
+
+/**
+ * @brief Destroys every atlas page and forgets all loaded images
+ */
+void SpriteAtlas_Destroy();
@@ -0,0 +1,64 @@
+/**
+ * @file sprite_batch.h
+ * @brief Collects sprite draws and submits them with SDL_RenderGeometry
+ *
+ * Between SpriteBatch_Begin() and SpriteBatch_End(), sprites that share a
+ * texture (usually a SpriteAtlas page) are queued and drawn in a single
+ * SDL_RenderGeometry call. Outside of a batch, SpriteBatch_Draw() draws
+ * immediately, so code can use it without knowing whether a batch is open.
+ *
+ * @warning Anything drawn with plain SDL calls while a batch is open ends
+ * up below the queued sprites. Call SpriteBatch_Flush() before such draws.
+ *
+ * @section batch_usage Usage
+ * ```c
+ * SpriteBatch_Begin();
+ * for (int i = 0; i < count; i++) {
+ *     SpriteBatch_Draw(texture, &src[i], &dest[i], 0, NULL, SDL_FLIP_NONE, 255);
+ * }
+ * SpriteBatch_End();
+ * ```
+ *
+ * @author Mango
+ * @date 2025-04-14
+ */
+
+#pragma once
+
+#include <SDL.h>
+#include <stdbool.h>
+
+/**
+ * @brief Sprites queued before the batch is flushed on its own
+ */
+#define SPRITE_BATCH_MAX_SPRITES 1024
+
+/**
+ * @brief Opens a batch
+ */
+void SpriteBatch_Begin();
+
+/**
+ * @brief Queues a sprite, or draws it right away if no batch is open
+ * @param texture The texture to draw from
+ * @param src Area of the texture to draw, NULL for the whole texture
+ * @param dest Where to draw on screen
+ * @param angle Rotation angle in degrees, clockwise
+ * @param center Rotation center relative to dest, NULL for the center of dest
+ * @param flip The flip mode for the sprite
+ * @param alpha Opacity of the sprite
+ */
+void SpriteBatch_Draw(
+    SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dest,
+    float angle, const SDL_Point* center, SDL_RendererFlip flip, Uint8 alpha
+);
+
+/**
+ * @brief Draws every queued sprite now and keeps the batch open
+ */
+void SpriteBatch_Flush();
+
+/**
+ * @brief Draws every queued sprite and closes the batch
+ */
+void SpriteBatch_End();
@@ -0,0 +1,42 @@
+/**
+ * @file stress_test.h
+ * @brief Debug scene that floods a room with enemies and reports per-type timings.
+ *
+ * Started with the `--stress N` command line option, which spawns N enemies of
+ * every non-boss type into an enlarged start room and keeps the population
+ * topped up. Every couple of seconds the average update and collision cost per
+ * simulation step and render cost per frame of each type is logged and shown
+ * on screen.
+ * Press escape to quit.
+ *
+ * @author Mango
+ * @date 2025-04-12
+ */
+
+#pragma once
+#include <SDL.h>
+
+/**
+ * @brief Size in tiles of the room the stress test spawns into
+ */
+#define STRESS_ROOM_SIZE_TILE 40
+
+/**
+ * @brief Seconds between two timing reports
+ */
+#define STRESS_REPORT_INTERVAL 2.0f
+
+/**
+ * @brief Prepares the stress room, spawns the enemies and switches to SCENE_STRESS_TEST.
+ */
+void Stress_Start();
+
+/**
+ * @brief Updates every enemy type while timing it, then refills the population.
+ */
+void Stress_Update();
+
+/**
+ * @brief Renders the stress room while timing each enemy type, plus the report overlay.
+ */
+void Stress_Render();
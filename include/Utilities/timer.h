@@ -60,6 +60,13 @@ typedef struct Timer {
  */
 Timer* Timer_Create(float duration);
 
+/**
+ * @brief Changes the duration of the timer, so it can be reused for a different cooldown.
+ * @param timer The timer to change.
+ * @param duration The new duration in seconds.
+ */
+void Timer_SetDuration(Timer *timer, float duration);
+
 /**
  * @brief Starts the timer.
  * @param timer The timer to start.
@@ -0,0 +1,128 @@
+/**
+ * @file app_arguments.c
+ * @brief Command line startup parameters
+ *
+ * Reads the command line into app.config before App_Start() runs,
+ * so that capacities sized at startup can be changed without rebuilding.
+ *
+ * @author Mango
+ * @date 2025-04-12
+ */
+
+#include <app.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief [Utility] Parses a positive integer argument value
+ *
+ * @param name Name of the option, used for error messages
+ * @param value The string to parse, may be NULL if the option was last
+ * @param out Where to store the parsed value
+ * @return int Status code (0 for success, non-zero for error)
+ */
+static int App_ParsePositiveInt(const char* name, const char* value, int* out) {
+    if (!value) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Missing value for %s", name);
+        return 1;
+    }
+    char* end = NULL;
+    long parsed = strtol(value, &end, 10);
+    if (*value == '\0' || *end != '\0' || parsed <= 0 || parsed > 1000000) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Invalid value for %s: %s", name, value);
+        return 1;
+    }
+    *out = (int) parsed;
+    return 0;
+}
+
+/**
+ * @brief [Start] Reads startup parameters from the command line
+ *
+ * Supported options:
+ * - `--enemy-capacity N`: number of enemy slots (default ENEMY_DEFAULT_CAPACITY)
+ * - `--enemy-wave-limit N`: cap on enemies per wave (default ENEMY_DEFAULT_WAVE_LIMIT)
+ * - `--stress N`: start in the stress test scene with N enemies of each type.
+ *   The enemy capacity is raised to fit if needed.
+ * - `--headless N`: run N frames on an offscreen window with the software
+ *   renderer and no audio, print the frame timing, then quit.
+ * - `--tick-rate N`: simulation steps per second (default TIME_DEFAULT_TICK_RATE)
+ * - `--spike-capture MS`: record profiler zones every frame and write the
+ *   frames leading up to any frame slower than MS milliseconds to a file
+ * - `--profile-trace PATH`: record profiler zones every frame and write the
+ *   last PROFILER_HISTORY_FRAMES of them to PATH on quit (see profiler.h)
+ * - `--map-size N`: chunks per side of generated maps (default MAP_DEFAULT_SIZE_CHUNK,
+ *   at least MAP_MIN_SIZE_CHUNK)
+ * - `--map-length N`: steps of the main path of generated maps (default MAP_DEFAULT_LENGTH)
+ * - `--seed N`: generate every run's maps from seed N instead of a new seed each run
+ * - `--record PATH`: record the session's input to PATH (see replay.h)
+ * - `--replay PATH`: play the recording at PATH back headless and print the
+ *   frame timing per scene and stage
+ *
+ * Unknown options are ignored, so platform launchers can pass their own.
+ *
+ * @param argc Number of arguments
+ * @param argv Argument strings, argv[0] being the program name
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int App_ParseArguments(int argc, char* argv[]) {
+    for (int i = 1; i < argc; i++) {
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "--enemy-capacity") == 0) {
+            if (App_ParsePositiveInt(argv[i], value, &app.config.enemyCapacity)) return 1;
+            i++;
+        } else if (strcmp(argv[i], "--enemy-wave-limit") == 0) {
+            if (App_ParsePositiveInt(argv[i], value, &app.config.enemyWaveLimit)) return 1;
+            i++;
+        } else if (strcmp(argv[i], "--stress") == 0) {
+            if (App_ParsePositiveInt(argv[i], value, &app.config.stressEnemyCount)) return 1;
+            i++;
+        } else if (strcmp(argv[i], "--headless") == 0) {
+            if (App_ParsePositiveInt(argv[i], value, &app.config.headlessFrames)) return 1;
+            i++;
+        } else if (strcmp(argv[i], "--tick-rate") == 0) {
+            if (App_ParsePositiveInt(argv[i], value, &app.config.tickRate)) return 1;
+            i++;
+        } else if (strcmp(argv[i], "--spike-capture") == 0) {
+            if (App_ParsePositiveInt(argv[i], value, &app.config.spikeThresholdMs)) return 1;
+            i++;
+        } else if (strcmp(argv[i], "--profile-trace") == 0) {
+            if (!value) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Missing value for %s", argv[i]);
+                return 1;
+            }
+            app.config.profileTracePath = argv[i + 1];
+            i++;
+        } else if (strcmp(argv[i], "--record") == 0) {
+            if (!value) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Missing value for %s", argv[i]);
+                return 1;
+            }
+            app.config.recordPath = argv[i + 1];
+            i++;
+        } else if (strcmp(argv[i], "--replay") == 0) {
+            if (!value) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Missing value for %s", argv[i]);
+                return 1;
+            }
+            app.config.replayPath = argv[i + 1];
+            i++;
+        } else if (strcmp(argv[i], "--map-size") == 0) {
+            if (App_ParsePositiveInt(argv[i], value, &app.config.mapSize)) return 1;
+            i++;
+        } else if (strcmp(argv[i], "--map-length") == 0) {
+            if (App_ParsePositiveInt(argv[i], value, &app.config.mapLength)) return 1;
+            i++;
+        } else if (strcmp(argv[i], "--seed") == 0) {
+            if (App_ParsePositiveInt(argv[i], value, &app.config.seed)) return 1;
+            i++;
+        }
+    }
+
+    // The stress test spawns every non-boss type at once
+    int stressCapacity = app.config.stressEnemyCount * (ENEMY_TYPE_COUNT - 1);
+    if (app.config.enemyCapacity < stressCapacity) {
+        app.config.enemyCapacity = stressCapacity;
+    }
+    return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file app_headless.c
+ * @brief Frame timing for headless runs
+ *
+ * With --headless N the normal loop in main.c runs for N frames on an
+ * offscreen window. Every frame reports how long the update routines and
+ * App_Render() took, and a summary is printed to stdout before quitting,
+ * so performance runs can be scripted on machines without a display.
+ * Replays (--replay) run the same way for the length of the recording.
+ *
+ * Every frame time is kept with the scene and stage it ran in, and the
+ * summary gives percentiles for each of them, so a boss fight is not
+ * averaged together with the menus around it.
+ *
+ * @author Mango
+ * @date 2025-04-15
+ */
+
+#include <app.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Timing collected over a headless run
+ */
+typedef struct HeadlessTiming {
+    int frames;             /**< Frames recorded so far */
+    Uint64 updateTicks;     /**< Total ticks spent updating */
+    Uint64 renderTicks;     /**< Total ticks spent rendering */
+    Uint64 minFrameTicks;   /**< Shortest frame */
+    Uint64 maxFrameTicks;   /**< Longest frame */
+} HeadlessTiming;
+
+/**
+ * @brief Time of one headless frame and where it was spent
+ */
+typedef struct HeadlessSample {
+    float frameMs;      /**< Update and render time of the frame */
+    AppScene scene;     /**< Scene at the end of the frame */
+    int stage;          /**< Stage of the game at the end of the frame */
+} HeadlessSample;
+
+static HeadlessSample* headlessSamples = NULL;
+static int headlessSampleCapacity = 0;
+
+static HeadlessTiming headlessTiming = {0};
+
+/**
+ * [Utility] Records the timing of one headless frame
+ *
+ * Stops the app once app.config.headlessFrames frames were recorded.
+ *
+ * @param updateTicks Performance counter ticks spent in the update routines
+ * @param renderTicks Performance counter ticks spent in App_Render()
+ */
+void App_RecordHeadlessFrame(Uint64 updateTicks, Uint64 renderTicks) {
+    Uint64 frameTicks = updateTicks + renderTicks;
+    if (headlessTiming.frames == 0 || frameTicks < headlessTiming.minFrameTicks) headlessTiming.minFrameTicks = frameTicks;
+    if (frameTicks > headlessTiming.maxFrameTicks) headlessTiming.maxFrameTicks = frameTicks;
+    headlessTiming.updateTicks += updateTicks;
+    headlessTiming.renderTicks += renderTicks;
+
+    if (headlessTiming.frames >= headlessSampleCapacity) {
+        int capacity = headlessSampleCapacity > 0 ? headlessSampleCapacity * 2 : 1024;
+        HeadlessSample* samples = realloc(headlessSamples, capacity * sizeof(HeadlessSample));
+        if (samples) {
+            headlessSamples = samples;
+            headlessSampleCapacity = capacity;
+        }
+    }
+    if (headlessTiming.frames < headlessSampleCapacity) {
+        headlessSamples[headlessTiming.frames] = (HeadlessSample) {
+            (float) (frameTicks * 1000.0 / SDL_GetPerformanceFrequency()),
+            app.state.currentScene,
+            game.currentStage
+        };
+    }
+    headlessTiming.frames++;
+
+    if (headlessTiming.frames >= app.config.headlessFrames) app.state.running = false;
+}
+
+/**
+ * @brief [Utility] Orders samples by scene, then stage, then frame time
+ */
+static int App_CompareHeadlessSamples(const void* a, const void* b) {
+    const HeadlessSample* first = a;
+    const HeadlessSample* second = b;
+    if (first->scene != second->scene) return first->scene < second->scene ? -1 : 1;
+    if (first->stage != second->stage) return first->stage < second->stage ? -1 : 1;
+    if (first->frameMs != second->frameMs) return first->frameMs < second->frameMs ? -1 : 1;
+    return 0;
+}
+
+/**
+ * @brief [Utility] Gets the name of a scene for the timing report
+ */
+static const char* App_GetSceneName(AppScene scene) {
+    switch (scene) {
+        case SCENE_MENU:                return "menu";
+        case SCENE_GAME:                return "game";
+        case SCENE_PAUSE:               return "pause";
+        case SCENE_DEATH:               return "death";
+        case SCENE_MISSION_BRIEFING:    return "briefing";
+        case SCENE_CONTROLS:            return "controls";
+        case SCENE_SETTINGS:            return "settings";
+        case SCENE_WIN:                 return "win";
+        case SCENE_STRESS_TEST:         return "stress";
+        default:                        return "unknown";
+    }
+}
+
+/**
+ * @brief [Quit] Prints frame time percentiles for every scene and stage the run went through
+ *
+ * Sorts the samples so each scene and stage is a sorted run of frame
+ * times, then reads the percentiles off each run (nearest rank).
+ */
+static void App_ReportHeadlessPercentiles() {
+    int count = headlessTiming.frames < headlessSampleCapacity ? headlessTiming.frames : headlessSampleCapacity;
+    if (count == 0) return;
+    qsort(headlessSamples, count, sizeof(HeadlessSample), App_CompareHeadlessSamples);
+
+    for (int start = 0; start < count;) {
+        int end = start;
+        while (end < count && headlessSamples[end].scene == headlessSamples[start].scene
+            && headlessSamples[end].stage == headlessSamples[start].stage) end++;
+
+        int frames = end - start;
+        const HeadlessSample* run = &headlessSamples[start];
+        printf("headless: %-8s stage %2d: %6d frames, p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+            App_GetSceneName(run->scene), run->stage, frames,
+            run[(frames - 1) * 50 / 100].frameMs,
+            run[(frames - 1) * 90 / 100].frameMs,
+            run[(frames - 1) * 99 / 100].frameMs,
+            run[frames - 1].frameMs);
+        start = end;
+    }
+    free(headlessSamples);
+    headlessSamples = NULL;
+    headlessSampleCapacity = 0;
+}
+
+/**
+ * [Quit] Prints the timing collected over a headless run
+ */
+void App_ReportHeadlessTiming() {
+    if (headlessTiming.frames == 0) return;
+    double msPerTick = 1000.0 / SDL_GetPerformanceFrequency();
+    double updateMs = headlessTiming.updateTicks * msPerTick;
+    double renderMs = headlessTiming.renderTicks * msPerTick;
+    double totalMs = updateMs + renderMs;
+
+    printf("headless: %d frames in %.1f ms (%.1f fps)\n",
+        headlessTiming.frames, totalMs, headlessTiming.frames * 1000.0 / totalMs);
+    printf("headless: frame avg %.3f ms, min %.3f ms, max %.3f ms\n",
+        totalMs / headlessTiming.frames,
+        headlessTiming.minFrameTicks * msPerTick,
+        headlessTiming.maxFrameTicks * msPerTick);
+    printf("headless: update avg %.3f ms, render avg %.3f ms\n",
+        updateMs / headlessTiming.frames, renderMs / headlessTiming.frames);
+    App_ReportHeadlessPercentiles();
+    fflush(stdout);
+}
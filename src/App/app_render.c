@@ -21,6 +21,8 @@
 #include <controls.h>
 #include <win.h> // Added for Win_Render function
 #include <settings.h>
+#include <stress_test.h>
+#include <profiler.h>
 
 /**
  * @brief [Render] Handles the main rendering of the game, like players, game environments, etc.
@@ -72,32 +74,37 @@ int App_RenderMain() {
             break;
 
         case SCENE_GAME:
-            Map_Render();
-            Interactable_Render();
-            Enemy_Render();
-            Player_Render();
-            Interactable_RenderEndRoom();
-            Gun_Render();
-            Enemy_RenderBoss();
-            Bullet_Render();
-            Debug_RenderHitboxes();
-            Interactable_RenderInteractionText();
-            HUD_Render();
-            EnemyManager_RenderClearText();
-            Log_Render();
-            LevelTransition_Render();
-            Player_RenderDamageEffect();
+            PROFILE_CALL(Map_Render());
+            PROFILE_CALL(Interactable_Render());
+            PROFILE_CALL(Enemy_Render());
+            PROFILE_CALL(Player_Render());
+            PROFILE_CALL(Interactable_RenderEndRoom());
+            PROFILE_CALL(Gun_Render());
+            PROFILE_CALL(Enemy_RenderBoss());
+            PROFILE_CALL(Bullet_Render());
+            PROFILE_CALL(Debug_RenderHitboxes());
+            PROFILE_CALL(Interactable_RenderInteractionText());
+            PROFILE_CALL(HUD_Render());
+            PROFILE_CALL(EnemyManager_RenderClearText());
+            PROFILE_CALL(Log_Render());
+            PROFILE_CALL(LevelTransition_Render());
+            PROFILE_CALL(Player_RenderDamageEffect());
             if(player.state.skillState.parryActive) Player_ParryRenderCircleVFX();
             break;
         case SCENE_SETTINGS:
             Settings_Render();
             break;
+        case SCENE_STRESS_TEST:
+            Stress_Render();
+            break;
         default:
             break;
     }
     Debug_RenderFPSCount();
     Debug_RenderSpikeCount();
     Debug_RenderCurrentChunk();
+    Debug_RenderAllocationCount();
+    Profiler_RenderOverlay();
 
     SDL_Rect cursorRect = Vec2_ToCenteredRect(
         Input->mouse.position,
@@ -117,6 +124,7 @@ int App_RenderMain() {
  * @return int Status code (0 for success)
  */
 int App_Render() {
+    PROFILER_ZONE_BEGIN("App_Render");
     // Set render target to screen texture
     SDL_SetRenderTarget(app.resources.renderer, app.resources.screenTexture);
 
@@ -124,7 +132,10 @@ int App_Render() {
     SDL_SetRenderDrawColor(app.resources.renderer, 0, 0, 0, 50);
     SDL_RenderClear(app.resources.renderer);
     
+    // Draw moving things between the last two simulation steps
+    Game_ApplyInterpolation();
     App_RenderMain();
+    Game_RestoreInterpolation();
 
     // Reset render target to window
     SDL_SetRenderTarget(app.resources.renderer, NULL);
@@ -132,7 +143,8 @@ int App_Render() {
     // Draw screen texture to window (possibly scaled)
     SDL_RenderCopy(app.resources.renderer, app.resources.screenTexture, NULL, NULL);
     
-    // Present final result
-    SDL_RenderPresent(app.resources.renderer);
+    // Present final result, waits for vsync when it is on
+    PROFILE_CALL(SDL_RenderPresent(app.resources.renderer));
+    PROFILER_ZONE_END();
     return 0;
 }
\ No newline at end of file
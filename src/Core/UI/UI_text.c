@@ -5,6 +5,11 @@
  * Provides functionality for creating, updating, and rendering
  * text elements in the user interface.
  *
+ * Text elements share their textures through a small LRU cache keyed by
+ * font and string. Glyphs are rasterized in white once, and the element
+ * color is applied with texture color and alpha mods when it is drawn, so
+ * hover highlights and fades never re-rasterize anything.
+ *
  * @author Mango
  * @date 2025-03-02
  */
@@ -14,6 +19,26 @@
 #include <input.h>
 #include <app.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <profiler.h>
+
+/**
+ * @brief A rasterized string shared by every text element showing it
+ */
+typedef struct UI_TextCacheEntry {
+    TTF_Font* font;         /**< Font the string was rendered with */
+    char* text;             /**< The rendered string, NULL if the slot is empty */
+    Uint32 hash;            /**< Hash of font and string, checked before comparing strings */
+    SDL_Texture* texture;   /**< White text texture */
+    int bytes;              /**< Approximate texture memory */
+    int refCount;           /**< Text elements currently using the texture */
+    Uint32 lastUsed;        /**< Value of textCacheClock when the entry was last acquired */
+} UI_TextCacheEntry;
+
+static UI_TextCacheEntry textCache[UI_TEXT_CACHE_MAX_ENTRIES];
+static int textCacheBytes = 0;
+static Uint32 textCacheClock = 0;
 
 // A map to store the hovered state of UI elements
 static bool hoveredStates[1024] = {false}; // Assuming a maximum of 1024 UI elements
@@ -48,7 +73,8 @@ UIElement* UI_CreateText(const char* text, SDL_Rect rect,
     }
     
     data->text = strdup(text);
-    data->textTexture = UI_CreateTextTexture(text, color, font);
+    PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 3);
+    data->textTexture = UI_AcquireTextTexture(text, font);
     data->alignment = alignment;
     data->font = font;
     
@@ -80,10 +106,136 @@ SDL_Texture* UI_CreateTextTexture(const char* text, SDL_Color color, TTF_Font* f
     
     SDL_Texture* texture = SDL_CreateTextureFromSurface(app.resources.renderer, surface);
     SDL_FreeSurface(surface);
+    PROFILER_COUNT(PROFILER_COUNTER_TEXTS_RASTERIZED, 1);
+    PROFILER_COUNT(PROFILER_COUNTER_TEXTURES_CREATED, 1);
     
     return texture;  // Caller is responsible for freeing
 }
 
+/**
+ * @brief [Utility] FNV-1a hash of a font pointer and a string
+ */
+static Uint32 UI_HashText(const char* text, TTF_Font* font) {
+    Uint32 hash = 2166136261u ^ (Uint32) (uintptr_t) font;
+    for (const unsigned char* c = (const unsigned char*) text; *c; c++) {
+        hash = (hash ^ *c) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief [Utility] Destroys a cache entry's texture and frees its slot
+ */
+static void UI_EvictTextCacheEntry(UI_TextCacheEntry* entry) {
+    SDL_DestroyTexture(entry->texture);
+    free(entry->text);
+    textCacheBytes -= entry->bytes;
+    *entry = (UI_TextCacheEntry) {0};
+}
+
+/**
+ * @brief [Utility] Evicts the least recently used unreferenced entry
+ * @return bool False if every cached texture is still in use
+ */
+static bool UI_EvictLeastRecentlyUsedText() {
+    UI_TextCacheEntry* oldest = NULL;
+    for (int i = 0; i < UI_TEXT_CACHE_MAX_ENTRIES; i++) {
+        UI_TextCacheEntry* entry = &textCache[i];
+        if (!entry->text || entry->refCount > 0) continue;
+        if (!oldest || entry->lastUsed < oldest->lastUsed) oldest = entry;
+    }
+    if (!oldest) return false;
+    UI_EvictTextCacheEntry(oldest);
+    return true;
+}
+
+/**
+ * [Utility] Returns a white texture of a string, rendering it only if it is not cached
+ *
+ * Every call must be paired with UI_ReleaseTextTexture(). Empty strings
+ * have no texture and return NULL. If the cache is full of textures that
+ * are all in use, the texture is still created and is destroyed on release.
+ *
+ * @param text The string to render
+ * @param font The font to render it with
+ * @return SDL_Texture* The shared texture, or NULL
+ */
+SDL_Texture* UI_AcquireTextTexture(const char* text, TTF_Font* font) {
+    if (!text || text[0] == '\0' || !font) return NULL;
+
+    Uint32 hash = UI_HashText(text, font);
+    UI_TextCacheEntry* freeSlot = NULL;
+    for (int i = 0; i < UI_TEXT_CACHE_MAX_ENTRIES; i++) {
+        UI_TextCacheEntry* entry = &textCache[i];
+        if (!entry->text) {
+            if (!freeSlot) freeSlot = entry;
+            continue;
+        }
+        if (entry->hash == hash && entry->font == font && strcmp(entry->text, text) == 0) {
+            entry->refCount++;
+            entry->lastUsed = ++textCacheClock;
+            return entry->texture;
+        }
+    }
+
+    SDL_Texture* texture = UI_CreateTextTexture(text, (SDL_Color) {255, 255, 255, 255}, font);
+    if (!texture) return NULL;
+    int w = 0, h = 0;
+    SDL_QueryTexture(texture, NULL, NULL, &w, &h);
+    int bytes = w * h * 4;
+
+    while (textCacheBytes + bytes > UI_TEXT_CACHE_MAX_BYTES && UI_EvictLeastRecentlyUsedText()) {}
+    if (!freeSlot && UI_EvictLeastRecentlyUsedText()) {
+        for (int i = 0; i < UI_TEXT_CACHE_MAX_ENTRIES && !freeSlot; i++) {
+            if (!textCache[i].text) freeSlot = &textCache[i];
+        }
+    }
+    if (!freeSlot) return texture;
+
+    PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 1);
+    *freeSlot = (UI_TextCacheEntry) {
+        .font = font,
+        .text = strdup(text),
+        .hash = hash,
+        .texture = texture,
+        .bytes = bytes,
+        .refCount = 1,
+        .lastUsed = ++textCacheClock
+    };
+    textCacheBytes += bytes;
+    return texture;
+}
+
+/**
+ * [Utility] Gives back a texture from UI_AcquireTextTexture()
+ *
+ * The texture stays cached until it is evicted, so text that comes back
+ * (menu labels, counters cycling through the same values) is reused.
+ *
+ * @param texture The texture to release, may be NULL
+ */
+void UI_ReleaseTextTexture(SDL_Texture* texture) {
+    if (!texture) return;
+    for (int i = 0; i < UI_TEXT_CACHE_MAX_ENTRIES; i++) {
+        if (textCache[i].text && textCache[i].texture == texture) {
+            if (textCache[i].refCount > 0) textCache[i].refCount--;
+            return;
+        }
+    }
+    // Not cached because the cache was full when it was acquired
+    SDL_DestroyTexture(texture);
+}
+
+/**
+ * [Quit] Destroys every cached text texture
+ */
+void UI_ClearTextCache() {
+    for (int i = 0; i < UI_TEXT_CACHE_MAX_ENTRIES; i++) {
+        if (textCache[i].text) UI_EvictTextCacheEntry(&textCache[i]);
+    }
+    textCacheBytes = 0;
+}
+
 void UI_UpdateText(UIElement* element) {
     UI_TextData* data = element->data;
     SDL_QueryTexture(data->textTexture, NULL, NULL, &element->textureSize.w, &element->textureSize.h);
@@ -108,7 +260,11 @@ void UI_UpdateText(UIElement* element) {
 
 void UI_RenderText(UIElement* element) {
     UI_TextData* data = element->data;
+    if (!data->textTexture) return;
     SDL_SetRenderDrawBlendMode(app.resources.renderer, SDL_BLENDMODE_BLEND);
+    // The texture is shared, so the color is set again before every draw
+    SDL_SetTextureColorMod(data->textTexture, element->color.r, element->color.g, element->color.b);
+    SDL_SetTextureAlphaMod(data->textTexture, element->color.a);
     SDL_RenderCopy(app.resources.renderer, data->textTexture, NULL, &element->dstRect);
 }
 
@@ -116,7 +272,7 @@ void UI_DestroyText(UIElement* element) {
     UI_TextData* data = element->data;
     if (data) {
         free(data->text);
-        SDL_DestroyTexture(data->textTexture);
+        UI_ReleaseTextTexture(data->textTexture);
         free(data);
     }
     free(element);
@@ -125,10 +281,18 @@ void UI_DestroyText(UIElement* element) {
 void UI_ChangeText(UIElement* element, const char* text) {
     UI_TextData* data = element->data;
     if (strcmp(text, data->text) == 0) return;
-    free(data->text);
-    data->text = strdup(text);
-    SDL_DestroyTexture(data->textTexture);
-    data->textTexture = UI_CreateTextTexture(text, element->color, data->font);
+    // Counters change every frame but rarely grow, so the old buffer is usually big enough
+    size_t length = strlen(text);
+    if (length > strlen(data->text)) {
+        char* grown = realloc(data->text, length + 1);
+        if (!grown) return;
+        data->text = grown;
+        PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 1);
+    }
+    memcpy(data->text, text, length + 1);
+    SDL_Texture* previous = data->textTexture;
+    data->textTexture = UI_AcquireTextTexture(text, data->font);
+    UI_ReleaseTextTexture(previous);
     UI_UpdateText(element);
 }
 
@@ -137,9 +301,6 @@ void UI_ChangeTextColor(UIElement* element, SDL_Color color) {
         element->color.g == color.g && 
         element->color.b == color.b && 
         element->color.a == color.a) return;
-    UI_TextData* data = element->data;
+    // Applied as texture mods in UI_RenderText, nothing has to be rendered again
     element->color = color;
-    SDL_DestroyTexture(data->textTexture);
-    data->textTexture = UI_CreateTextTexture(data->text, color, data->font);
-    UI_UpdateText(element);
 }
\ No newline at end of file
@@ -11,18 +11,23 @@
 
 #include <colliders.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 // Global collision registry
-Collider* ColliderList[MAX_COLLIDABLES];
+Collider** ColliderList = NULL;
 int ColliderCount = 0;
+int ColliderCapacity = 0;
+ColliderStats ColliderProfile = {0};
 
 /**
- * [Start] Initializes the Colliders array.
+ * [Start] Allocates and initializes the Colliders array.
+ * 
+ * @param capacity Number of colliders that can be registered at once
  */
-void Collider_Start() {
-    for (int i = 0; i < MAX_COLLIDABLES; i++) {
-        ColliderList[i] = NULL;
-    }
+void Collider_Start(int capacity) {
+    free(ColliderList);
+    ColliderList = calloc(capacity, sizeof(Collider*));
+    ColliderCapacity = ColliderList ? capacity : 0;
     ColliderCount = 0;
 }
 
@@ -34,17 +39,21 @@ void Collider_Start() {
  * @param owner A pointer to the owner of the collider. For example: &player
  */
 void Collider_Register(Collider* collider, void* owner) {
-    if (ColliderCount >= MAX_COLLIDABLES) {
+    if (ColliderCount >= ColliderCapacity) {
         printf("Error: Maximum collidables reached\n");
         return;
     }
     // Find first available slot
     int id = 0;
-    while (id < MAX_COLLIDABLES) {
+    while (id < ColliderCapacity) {
         if (ColliderList[id] == NULL) break;
         if (!ColliderList[id]->active) break;
         id++;
     }
+    if (id >= ColliderCapacity) {
+        printf("Error: Maximum collidables reached\n");
+        return;
+    }
     collider->active = true;
     collider->owner = owner;
     ColliderList[id] = collider;
@@ -52,18 +61,10 @@ void Collider_Register(Collider* collider, void* owner) {
 }
 
 /**
- * [PostUpdate] Checks if a collider is intersecting with any of its collider layers.
- * This function checks for collision between a collider and everything else in the
- * ColliderList array. Any colliders whose layer is not in the input collider's 
- * collidesWith section will be ignored.
- * 
- * @param collider The input collider
- * @param checkResult The checkResult of the collider, which includes 2 members:
- *   checkResult.objects: an array of detected colliders
- *   checkResult.count: number of collisions detected
- * @return true if collision detected, false otherwise
+ * [PostUpdate] Scans the registry for colliders intersecting the input collider.
+ * This is the untimed body of Collider_Check().
  */
-bool Collider_Check(Collider* collider, ColliderCheckResult* checkResult) {
+static bool Collider_CheckRegistry(Collider* collider, ColliderCheckResult* checkResult) {
     if (!collider) return false; // Check if collider is NULL
     if (!collider->active) return false;
     
@@ -100,6 +101,29 @@ bool Collider_Check(Collider* collider, ColliderCheckResult* checkResult) {
     return false;
 }
 
+/**
+ * [PostUpdate] Checks if a collider is intersecting with any of its collider layers.
+ * This function checks for collision between a collider and everything else in the
+ * ColliderList array. Any colliders whose layer is not in the input collider's 
+ * collidesWith section will be ignored.
+ * While ColliderProfile.enabled is set, the time spent is added to ColliderProfile.
+ * 
+ * @param collider The input collider
+ * @param checkResult The checkResult of the collider, which includes 2 members:
+ *   checkResult.objects: an array of detected colliders
+ *   checkResult.count: number of collisions detected
+ * @return true if collision detected, false otherwise
+ */
+bool Collider_Check(Collider* collider, ColliderCheckResult* checkResult) {
+    if (!ColliderProfile.enabled) return Collider_CheckRegistry(collider, checkResult);
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    bool collided = Collider_CheckRegistry(collider, checkResult);
+    ColliderProfile.checkTicks += SDL_GetPerformanceCounter() - start;
+    ColliderProfile.checkCount++;
+    return collided;
+}
+
 /**
  * @brief Deactivates a collider and resets its properties
  * 
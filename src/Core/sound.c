@@ -18,6 +18,9 @@
 #include <string.h>
 #include <SDL.h> 
 #include <settings.h>
+#include <profiler.h>
+#include <asset_archive.h>
+#include <asset_loader.h>
 
 /**
  * @brief Sets the maximum number of sound effect channels.
@@ -28,6 +31,9 @@ void Sound_Set_Max_Channels(int numChannels) {
     Mix_AllocateChannels(numChannels);
 }
 
+// Set once the audio device is open. Headless runs never open it, and every playback call is skipped
+static bool soundSystemOpen = false;
+
 // Initialize the sound resources structure
 SoundResources soundResources = {
     .backgroundMusic = NULL,
@@ -90,10 +96,20 @@ bool Sound_System_Initialize() {
         return false;
     }
     Sound_Set_Max_Channels(32); // Set the maximum number of sound effect channels
+    soundSystemOpen = true;
     
     return true;
 }
 
+/*
+*   [Start] Queue the sound effects for the startup asset loader, the audio device must be open
+*/
+void Sound_QueueAssets() {
+    for (int i = 0; i < SOUND_COUNT; i++) {
+        AssetLoader_QueueSound(soundResources.soundPaths[i], &soundResources.soundEffects[i]);
+    }
+}
+
 /*
 *   [Start] Load sound resources
 *   @return true if successful, false otherwise
@@ -101,8 +117,10 @@ bool Sound_System_Initialize() {
 bool Sound_Load_Resources() {
     // Load sound effects
     // TODO: Maybe make this into a function?
+    // Sounds the asset loader decoded at startup are already set
     for(int i = 0; i < SOUND_COUNT;i++){
-        soundResources.soundEffects[i] = Mix_LoadWAV(soundResources.soundPaths[i]);
+        if (soundResources.soundEffects[i]) continue;
+        soundResources.soundEffects[i] = Mix_LoadWAV_RW(AssetArchive_OpenFile(soundResources.soundPaths[i]), 1);
         if (soundResources.soundEffects[i] == NULL) {
             printf("Failed to load sound effect! SDL_mixer Error: %s\n", Mix_GetError());
             return false;
@@ -130,6 +148,7 @@ bool Sound_Load_Resources() {
  * @todo [sound.c:95] Maybe implement a way to play sound effects by name?
  */
 void Sound_Play_Effect(int index) {
+    if (!soundSystemOpen) return;
     if (index >= 0 && index < SOUND_COUNT) {
         Mix_PlayChannel(-1, soundResources.soundEffects[index], 0);
     }
@@ -137,7 +156,8 @@ void Sound_Play_Effect(int index) {
 
 
 float Sound_Get_Music_Duration(const char* path) {
-    Mix_Music* music = Mix_LoadMUS(path);
+    if (!soundSystemOpen) return -1.0f;
+    Mix_Music* music = Mix_LoadMUS_RW(AssetArchive_OpenFile(path), 1);
     if (!music) {
         printf("Failed to load music: %s\n", Mix_GetError());
         return -1.0f;
@@ -152,6 +172,7 @@ float Sound_Get_Music_Duration(const char* path) {
  * [Utility] Stop background music
  */
 void Sound_Stop_Music() {
+    if (!soundSystemOpen) return;
     Mix_HaltMusic();
 }
 
@@ -173,7 +194,8 @@ void Sound_System_Cleanup() {
         }
     }
     
-    Mix_CloseAudio();
+    if (soundSystemOpen) Mix_CloseAudio();
+    soundSystemOpen = false;
 }
 
 
@@ -207,6 +229,11 @@ void Music_Finished_Callback() {
  * @return true if queued successfully, false if failed
  */
 bool Sound_Queue_Next_Song(const char* path) {
+    // Queued every frame during gameplay, only copy the path when the song changes
+    if (musicQueue.hasNextSong && musicQueue.nextSongPath && strcmp(musicQueue.nextSongPath, path) == 0) {
+        return true;
+    }
+
     // If there's already a song queued, replace it
     if (musicQueue.nextSongPath != NULL) {
         free(musicQueue.nextSongPath);
@@ -214,6 +241,7 @@ bool Sound_Queue_Next_Song(const char* path) {
     
     // Queue the new song
     musicQueue.nextSongPath = strdup(path);
+    PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 1);
     musicQueue.hasNextSong = true;
     
     // Enable the callback to handle transition
@@ -239,6 +267,8 @@ void Sound_Clear_Queue() {
  * [Update] Update Sound_Play_Music to free previous music
  */
 void Sound_Play_Music(const char* path, int loops) {
+    if (!soundSystemOpen) return;
+
     // Free previous music if it exists
     if (soundResources.backgroundMusic != NULL) {
         Mix_FreeMusic(soundResources.backgroundMusic);
@@ -246,7 +276,8 @@ void Sound_Play_Music(const char* path, int loops) {
     }
     
     // Load and play new music
-    soundResources.backgroundMusic = Mix_LoadMUS(path);
+    // Music streams from its RWops while it plays, archive views stay valid until quit
+    soundResources.backgroundMusic = Mix_LoadMUS_RW(AssetArchive_OpenFile(path), 1);
     if (soundResources.backgroundMusic == NULL) {
         printf("Failed to load music: %s\n", Mix_GetError());
         return;
@@ -256,6 +287,7 @@ void Sound_Play_Music(const char* path, int loops) {
 }
 
 void Sound_UpdateVolume() {
+    if (!soundSystemOpen) return;
     float musicVolume = Settings_GetMusicVolume() * Settings_GetMasterVolume();
     float soundVolume = Settings_GetSoundVolume() * Settings_GetMasterVolume();
     Mix_VolumeMusic((int)(MIX_MAX_VOLUME * musicVolume));
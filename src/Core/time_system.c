@@ -23,9 +23,19 @@ TimeSystem time = {
     .rawDeltaTimeSeconds = 0,
     .programElapsedTimeSeconds = 0,
     .rawProgramElapsedTimeSeconds = 0,
-    .previousTick = 0
+    .previousCounter = 0,
+    .fixedDeltaTimeSeconds = 1.0f / TIME_DEFAULT_TICK_RATE,
+    .accumulatorSeconds = 0,
+    .interpolationAlpha = 1,
+    .frameSeconds = 0
 };
 
+// Unscaled frame time, restored after the fixed steps so rendering sees the real frame time
+static float rawFrameDeltaTimeSeconds = 0;
+
+// Frame time the next Time_PreUpdate() uses instead of measuring it, negative when not set
+static double nextFrameSeconds = -1;
+
 /** Global read-only time system pointer for other modules */
 const TimeSystem * const Time = &time; // This ensures that the Time variable is read-only to other files.
 
@@ -33,20 +43,67 @@ const TimeSystem * const Time = &time; // This ensures that the Time variable is
  * @brief [PreUpdate] Updates the time system values
  * 
  * Called at the beginning of each frame to calculate delta time and
- * other time-related metrics. Caps deltaTime to prevent spiral of death
+ * other time-related metrics, and to add the frame time to the fixed step
+ * accumulator. Caps deltaTime and the accumulator to prevent spiral of death
  * if the game freezes temporarily.
  */
 void Time_PreUpdate() {
-    float currentTick = SDL_GetTicks();
-    time.rawDeltaTimeSeconds = (currentTick - time.previousTick) / 1000;
-    time.rawProgramElapsedTimeSeconds += time.rawDeltaTimeSeconds;
+    // Counter differences stay exact in 64 bits, no matter how long the session runs
+    Uint64 currentCounter = SDL_GetPerformanceCounter();
+    if (time.previousCounter == 0) time.previousCounter = currentCounter;
+    double frameSeconds = (double) (currentCounter - time.previousCounter) / SDL_GetPerformanceFrequency();
+    if (nextFrameSeconds >= 0) {
+        frameSeconds = nextFrameSeconds;
+        nextFrameSeconds = -1;
+    }
+    time.frameSeconds = frameSeconds;
+    time.rawDeltaTimeSeconds = frameSeconds;
+    time.rawProgramElapsedTimeSeconds += frameSeconds;
     time.deltaTimeSeconds = time.rawDeltaTimeSeconds * time.timeScale;
     if (time.deltaTimeSeconds > 0.1f) time.deltaTimeSeconds = 0.1f;
-    time.programElapsedTimeSeconds += time.deltaTimeSeconds;
-    time.previousTick = currentTick;
+    time.previousCounter = currentCounter;
+
+    time.accumulatorSeconds += frameSeconds;
+    double maxAccumulated = time.fixedDeltaTimeSeconds * TIME_MAX_STEPS_PER_FRAME;
+    if (time.accumulatorSeconds > maxAccumulated) time.accumulatorSeconds = maxAccumulated;
+
+    rawFrameDeltaTimeSeconds = time.rawDeltaTimeSeconds;
     Time_UpdateFPS();
 }
 
+/**
+ * @brief [PostUpdate] Starts the next simulation step if enough time has accumulated
+ * 
+ * While a step runs, deltaTimeSeconds is the fixed step scaled by the time
+ * scale and rawDeltaTimeSeconds is the unscaled step. The program time only
+ * advances in steps, so timers tick at the simulation rate.
+ * 
+ * @return bool True if a step should run now
+ */
+bool Time_BeginFixedStep() {
+    if (time.accumulatorSeconds < time.fixedDeltaTimeSeconds) return false;
+    time.accumulatorSeconds -= time.fixedDeltaTimeSeconds;
+    time.rawDeltaTimeSeconds = time.fixedDeltaTimeSeconds;
+    time.deltaTimeSeconds = time.fixedDeltaTimeSeconds * time.timeScale;
+    time.programElapsedTimeSeconds += time.deltaTimeSeconds;
+    return true;
+}
+
+/**
+ * @brief [PostUpdate] Restores the frame delta time after the simulation steps
+ * 
+ * Also works out how far the leftover time is into the next step, which
+ * the renderer uses to interpolate between the last two steps.
+ */
+void Time_EndFixedSteps() {
+    time.interpolationAlpha = time.accumulatorSeconds / time.fixedDeltaTimeSeconds;
+    if (time.interpolationAlpha > 1) time.interpolationAlpha = 1;
+    time.rawDeltaTimeSeconds = rawFrameDeltaTimeSeconds;
+    // The time scale may have changed during the steps
+    time.deltaTimeSeconds = rawFrameDeltaTimeSeconds * time.timeScale;
+    if (time.deltaTimeSeconds > 0.1f) time.deltaTimeSeconds = 0.1f;
+}
+
 /**
  * @brief [Utility] Updates the FPS counter
  * 
@@ -65,7 +122,7 @@ void Time_UpdateFPS() {
     // Update FPS once per second
     if (fpsTimer >= 0.5f) {
         app.state.fps = (int)(frameCount / fpsTimer);
-        app.state.averageFps = (int)(totalFrame / time.programElapsedTimeSeconds);
+        app.state.averageFps = (int)(totalFrame / time.rawProgramElapsedTimeSeconds);
         frameCount = 0;
         fpsTimer = 0.0f;
     }
@@ -92,4 +149,61 @@ void Time_SetTimeScale(float scale) {
  */
 void Time_ResetTotalTime() {
     time.programElapsedTimeSeconds = 0;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief [Render] Waits until the current frame has lasted 1 / maxFps seconds.
+ * 
+ * Called after the frame is presented. Sleeps with SDL_Delay() while the
+ * deadline is far away, then spins on the performance counter for the last
+ * TIME_LIMITER_SPIN_MILLISECONDS, which keeps frame pacing precise without
+ * burning a whole core. A frame that runs late starts a new schedule
+ * instead of making the next frames rush to catch up.
+ * 
+ * @param maxFps The frame rate limit, 0 or less to not limit the frame rate.
+ */
+void Time_LimitFrameRate(int maxFps) {
+    static Uint64 frameDeadline = 0;
+    if (maxFps <= 0) {
+        frameDeadline = 0;
+        return;
+    }
+
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 period = frequency / maxFps;
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (frameDeadline == 0) {
+        frameDeadline = now + period;
+        return;
+    }
+
+    while (now < frameDeadline) {
+        double remainingMilliseconds = (double) (frameDeadline - now) * 1000.0 / frequency;
+        if (remainingMilliseconds > TIME_LIMITER_SPIN_MILLISECONDS) {
+            SDL_Delay((Uint32) (remainingMilliseconds - TIME_LIMITER_SPIN_MILLISECONDS));
+        }
+        now = SDL_GetPerformanceCounter();
+    }
+    frameDeadline = now - frameDeadline > period ? now + period : frameDeadline + period;
+}
+
+/**
+ * @brief [Start] Sets how many simulation steps run per second.
+ * 
+ * @param ticksPerSecond Steps per second, values below 1 are ignored.
+ */
+void Time_SetTickRate(int ticksPerSecond) {
+    if (ticksPerSecond < 1) return;
+    time.fixedDeltaTimeSeconds = 1.0f / ticksPerSecond;
+}
+
+/**
+ * @brief [PreUpdate] Makes the next frame last a given time instead of the measured one.
+ * 
+ * Replays use it to run the same simulation steps as the recorded frame.
+ * 
+ * @param seconds The frame time, as stored from TimeSystem.frameSeconds.
+ */
+void Time_SetFrameSeconds(double seconds) {
+    nextFrameSeconds = seconds;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file enemy_buckets.c
+ * @brief Type-bucketed live enemy lists
+ *
+ * Keeps a dense list of live enemy slots for every enemy type, so that
+ * the update and render loops only touch enemies that exist and run
+ * each type's logic back to back.
+ *
+ * @author Mango
+ * @date 2025-04-12
+ */
+
+#include <enemy.h>
+
+/**
+ * @brief [Data] One bucket of live enemy indices per enemy type
+ */
+EnemyBucket EnemyBuckets[ENEMY_TYPE_COUNT];
+
+/**
+ * @brief [Start] Empties every bucket
+ */
+void Enemy_ResetBuckets() {
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        EnemyBuckets[type].count = 0;
+    }
+    for (int i = 0; i < Enemy_Capacity; i++) {
+        enemies[i].state.isTracked = false;
+    }
+}
+
+/**
+ * @brief [Utility] Adds a freshly spawned enemy to its type's bucket
+ *
+ * @param enemy Pointer to the enemy slot inside the enemies array
+ */
+void Enemy_TrackLive(EnemyData* enemy) {
+    if (enemy->state.isTracked) return;
+    if (enemy->type < 0 || enemy->type >= ENEMY_TYPE_COUNT) return;
+
+    EnemyBucket* bucket = &EnemyBuckets[enemy->type];
+    bucket->indices[bucket->count++] = (int) (enemy - enemies);
+    enemy->state.isTracked = true;
+}
+
+/**
+ * @brief [PostUpdate] Removes dead enemies from every bucket
+ *
+ * Enemies can die from many places (their own update, explosions, restarts),
+ * so dead entries are left in place and swept out here once per frame.
+ * A slot stays reserved until it has been swept, which keeps a bucket
+ * from ever listing the same slot twice.
+ */
+void Enemy_CompactBuckets() {
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        EnemyBucket* bucket = &EnemyBuckets[type];
+        int kept = 0;
+        for (int i = 0; i < bucket->count; i++) {
+            int index = bucket->indices[i];
+            if (enemies[index].state.isDead) {
+                enemies[index].state.isTracked = false;
+                Chunk_ReleaseSpawnTile(&enemies[index].state.spawnReservation);
+                continue;
+            }
+            bucket->indices[kept++] = index;
+        }
+        bucket->count = kept;
+    }
+}
@@ -161,7 +161,7 @@ EnemyData* Enemy_SelectRandomEnemyInComp(EnemyComp* comp) {
     }
 
     // Randomly select one of the available types
-    int randomIndex = RandInt(0, availableTypes - 1);
+    int randomIndex = Random_Int(RANDOM_STREAM_AI, 0, availableTypes - 1);
     int selectedTypeIndex = availableIndices[randomIndex];
     
     // Increment spawn count for the selected enemy type
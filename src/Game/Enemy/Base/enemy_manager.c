@@ -15,6 +15,7 @@
 #include <player.h>
 #include <time_system.h>
 #include <random.h>
+#include <minimap.h>
 
 /**
  * @brief [Utility] Counts the number of active enemies in a specific chunk
@@ -24,9 +25,13 @@
  */
 int EnemyManage_CountEnemyInChunk(EnvironmentChunk* chunk) {
     int count = 0;
-    for (int i = 0; i < ENEMY_MAX; i++) {
-        if (!enemies[i].state.isDead && Chunk_GetCurrentChunk(enemies[i].state.position) == chunk) {
-            count++;
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        EnemyBucket* bucket = &EnemyBuckets[type];
+        for (int i = 0; i < bucket->count; i++) {
+            EnemyData* enemy = &enemies[bucket->indices[i]];
+            if (!enemy->state.isDead && Chunk_GetCurrentChunk(enemy->state.position) == chunk) {
+                count++;
+            }
         }
     }
     return count;
@@ -66,13 +71,13 @@ void EnemyManager_Update() {
         // Start combat only if there are enemies left in the totalEnemyCount
         if (chunk->totalEnemyCount > 0) {
             chunk->inCombat = true;
-            chunk->hallways = HALLWAY_NONE;
-            Chunk_GenerateTilesButVoid(chunk);
+            Minimap_Invalidate();
+            Chunk_SetDoorsClosed(chunk, chunk->hallways);
             if (chunk->roomType == ROOM_TYPE_BOSS) {
                 Sound_Play_Music("Assets/Audio/Music/return0 boss music.wav", 0);
             }
 
-            chunk->totalEnemyCount = RandInt(
+            chunk->totalEnemyCount = Random_Int(RANDOM_STREAM_AI, 
                 EnemyComps[game.currentStage - 1].enemyMinSpawnCount,
                 EnemyComps[game.currentStage - 1].enemyMaxSpawnCount
             );
@@ -86,8 +91,8 @@ void EnemyManager_Update() {
         } else {
             // Ends the combat if player has killed enough enemies
             chunk->inCombat = false;
-            chunk->hallways = Map_GetChunkHallways(*chunk, testMap);
-            Chunk_GenerateTilesButVoid(chunk);
+            Minimap_Invalidate();
+            Chunk_SetDoorsClosed(chunk, HALLWAY_NONE);
             currentClearTextAlpha = 255;
             Enemy_ResetComp(&EnemyComps[game.currentStage - 1]);
             if (chunk->roomType == ROOM_TYPE_BOSS) {
@@ -104,14 +109,14 @@ void EnemyManager_Update() {
     if (chunk->inCombat && player.state.currentAmmo <= player.state.currentGun.stats.ammoConsumption) {
         funnyTimer += Time->deltaTimeSeconds;
         if (funnyTimer >= 0.5f) {
-            Vec2 spawnPosition = Chunk_GetRandomTileCenterInRoom(chunk);
-            Enemy_Spawn(*enemyList[ENEMY_TYPE_KAMIKAZE], spawnPosition);
+            Enemy_SpawnInRoom(*enemyList[ENEMY_TYPE_KAMIKAZE], chunk);
             funnyTimer = 0;
         }
     }
 
-    if (chunk->currentEnemyCount <= 0 && chunk->totalEnemyCount <= 0 && !chunk->inCombat) {
+    if (chunk->currentEnemyCount <= 0 && chunk->totalEnemyCount <= 0 && !chunk->inCombat && !chunk->discovered) {
         chunk->discovered = true;
+        Minimap_Invalidate();
     }
 }
 
@@ -138,6 +143,6 @@ void EnemyManager_RenderClearText() {
     }
 
     UI_UpdateText(clearText);
-    SDL_SetTextureAlphaMod(((UI_TextData*) (clearText->data))->textTexture, (int) currentClearTextAlpha);
+    UI_ChangeTextColor(clearText, (SDL_Color){255, 255, 255, (Uint8) currentClearTextAlpha});
     UI_RenderText(clearText);
 }
\ No newline at end of file
@@ -15,24 +15,29 @@
 #include <camera.h>
 #include <player.h>
 #include <app.h>
+#include <sprite_batch.h>
+#include <lazer_system.h>
 
 /**
- * @brief [Render] Renders all active enemies
+ * @brief [Render] Renders every live enemy of one type
+ * 
+ * Draws spawn indicators for enemies that are still spawning and calls
+ * each enemy's specific render function otherwise.
  * 
- * Iterates through the enemy array and calls each enemy's specific
- * render function if they are active.
+ * @param type The enemy type whose bucket should be rendered
  */
-void Enemy_Render() {
-    ParticleEmitter_Render(TacticianBuffEffectEmitter);
-    for (int i = 0; i < ENEMY_MAX; i++) {
-        if (enemies[i].state.isDead) continue;
-        if (!enemies[i].resources.animation) continue;
-        if (enemies[i].state.isSpawning) {
-            SDL_Rect dest = Tile_GetRectFromPixel(enemies[i].state.position);
+void Enemy_RenderType(EnemyType type) {
+    EnemyBucket* bucket = &EnemyBuckets[type];
+    for (int j = 0; j < bucket->count; j++) {
+        EnemyData* enemy = &enemies[bucket->indices[j]];
+        if (enemy->state.isDead) continue;
+        if (!enemy->resources.animation) continue;
+        if (enemy->state.isSpawning) {
+            SDL_Rect dest = Tile_GetRectFromPixel(enemy->state.position);
             Vec2 position, size;
             Vec2_FromRect(dest, &position, &size);
-            
-            float timeLeft = Timer_GetTimeLeft(enemies[i].resources.timer);
+        
+            float timeLeft = Timer_GetTimeLeft(enemy->resources.timer);
             int opacity = 255;
             if (timeLeft > 0.5f) {
                 /*
@@ -51,37 +56,67 @@ void Enemy_Render() {
             if (!Camera_WorldRectIsOnScreen(dest)) continue;
             dest = Vec2_ToCenteredRect(Camera_WorldVecToScreen(position), size);
 
-            SDL_SetTextureAlphaMod(Enemy_spawnIndicator, opacity);
-            SDL_RenderCopy(
-                app.resources.renderer,
-                Enemy_spawnIndicator,
+            SpriteBatch_Draw(
+                Enemy_spawnIndicator.texture,
+                &Enemy_spawnIndicator.rect,
+                &dest,
+                0,
                 NULL,
-                &dest
+                SDL_FLIP_NONE,
+                opacity
             );
             continue;
         }
 
-        if (enemies[i].type == ENEMY_TYPE_LIBET) {
+        if (enemy->type == ENEMY_TYPE_LIBET) {
             continue;
         }
         // don't render if the enemy is not in the view
-        if (Camera_WorldRectIsOnScreen(enemies[i].state.collider.hitbox))
-        
+        if (Camera_WorldRectIsOnScreen(enemy->state.collider.hitbox))
+    
         Animation_Render(
-            enemies[i].resources.animation,
+            enemy->resources.animation,
             Camera_WorldVecToScreen(
                 Vec2_ToCenteredPosition(
-                    enemies[i].state.position, 
-                    enemies[i].animData.spriteSize
+                    enemy->state.position, 
+                    enemy->animData.spriteSize
                 )
             ),
-            enemies[i].animData.spriteSize,
+            enemy->animData.spriteSize,
             0,
             NULL,
-            enemies[i].state.flip
+            enemy->state.flip
         );
-        if (enemies[i].render) enemies[i].render(&enemies[i]);
+        if (enemy->render) enemy->render(enemy);
+    }
+}
+
+/**
+ * @brief [Render] Renders all active enemies
+ * 
+ * Walks the live enemy buckets one type at a time inside one sprite
+ * batch. Enemy, gun and spawn indicator sprites all live in the sprite
+ * atlas, so they are submitted together unless a type's render
+ * function has to flush for its own draws.
+ */
+void Enemy_Render() {
+    ParticleEmitter_Render(TacticianBuffEffectEmitter);
+    SpriteBatch_Begin();
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        Enemy_RenderType(type);
     }
+    SpriteBatch_End();
+    Enemy_RenderEffects();
+}
+
+/**
+ * @brief [Render] Renders effects shared by all enemies of a type
+ * 
+ * Lazer beams queued by the enemies, damage numbers and the per-type
+ * bullet/particle emitters.
+ */
+void Enemy_RenderEffects() {
+    Lazer_FlushBeams();
     Enemy_RenderHealthTexts();
     if (KamikazeExplosionEmitter) ParticleEmitter_Render(KamikazeExplosionEmitter);
     Proxy_RenderParticles();
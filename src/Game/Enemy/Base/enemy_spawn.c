@@ -24,10 +24,13 @@
  * 
  * @param data The enemy data template to use for spawning
  * @param position Position vector for enemy spawn location
+ * @return EnemyData* The spawned enemy, or NULL if every slot is taken
  */
-void Enemy_Spawn(EnemyData data, Vec2 position) {
-    for (int i = 0; i < ENEMY_MAX; i++) {
+EnemyData* Enemy_Spawn(EnemyData data, Vec2 position) {
+    for (int i = 0; i < Enemy_Capacity; i++) {
         if (!enemies[i].state.isDead) continue;
+        // Dead slots still listed in a bucket are reused after the next sweep
+        if (enemies[i].state.isTracked) continue;
         EnemyData* enemy = &enemies[i];
         memcpy(enemy, &data, sizeof(EnemyData));
 
@@ -45,22 +48,68 @@ void Enemy_Spawn(EnemyData data, Vec2 position) {
         enemy->resources.animation = Animation_Create(&enemy->animData);
         enemy->resources.timer = Timer_Create(1.0f);
         Timer_Start(enemy->resources.timer);
+        // On the spawning layer until the delay is over, so other enemies keep off the spot
+        enemy->state.collider.layer = COLLISION_LAYER_ENEMY_SPAWNING;
+        if (enemy->state.collider.collidesWith & COLLISION_LAYER_ENEMY) {
+            enemy->state.collider.collidesWith |= COLLISION_LAYER_ENEMY_SPAWNING;
+        }
+        Collider_Register(&enemy->state.collider, enemy);
         if (enemy->start) enemy->start(enemy);
-        break;
+        Enemy_TrackLive(enemy);
+        return enemy;
     }
+    return NULL;
 }
 
+/**
+ * @brief [Utility] Spawns a single enemy on a free tile of a room
+ * 
+ * The tile comes from the room's spawn grid, which leaves out the tiles
+ * under the player and every live enemy in the room. The enemy's
+ * reservation follows it around until it dies.
+ * 
+ * @param data The enemy data template to use for spawning
+ * @param chunk The room to spawn into
+ * @return EnemyData* The spawned enemy, or NULL if the room or the enemy slots are full
+ */
+EnemyData* Enemy_SpawnInRoom(EnemyData data, EnvironmentChunk* chunk) {
+    Vec2 spawnPosition;
+    ChunkSpawnReservation reservation;
+    SDL_Rect hitbox = data.state.collider.hitbox;
+    if (!Chunk_TakeSpawnTile(chunk, (Vec2) {hitbox.w, hitbox.h}, &spawnPosition, &reservation)) return NULL;
+
+    EnemyData* enemy = Enemy_Spawn(data, spawnPosition);
+    if (enemy) {
+        enemy->state.spawnReservation = reservation;
+        // The boss places itself in the center of the room instead
+        Chunk_MoveSpawnReservation(&enemy->state.spawnReservation, enemy->state.position, (Vec2) {hitbox.w, hitbox.h});
+    } else {
+        Chunk_ReleaseSpawnTile(&reservation);
+    }
+    return enemy;
+}
+
+/**
+ * @brief [Utility] Spawns a wave of enemies into a room
+ * 
+ * Spawn points are drawn from the room's spawn grid, so enemies of the
+ * same wave never overlap each other or the enemies already there.
+ * 
+ * @param chunk The room to spawn into
+ */
 void Enemy_SpawnWave(EnvironmentChunk* chunk) {
-    int spawnCount = RandInt(chunk->totalEnemyCount / 2, chunk->totalEnemyCount);
-    if (spawnCount > 25)   spawnCount = 25;
+    int spawnCount = Random_Int(RANDOM_STREAM_AI, chunk->totalEnemyCount / 2, chunk->totalEnemyCount);
+    if (spawnCount > app.config.enemyWaveLimit)   spawnCount = app.config.enemyWaveLimit;
 
     for (int i = 0; i < spawnCount; i++) {
         if (chunk->totalEnemyCount <= 0) break;
-        chunk->totalEnemyCount--;
 
-        Vec2 spawnPosition = Chunk_GetRandomTileCenterInRoom(chunk);
         EnemyData* spawnedEnemy = Enemy_SelectRandomEnemyInComp(&EnemyComps[game.currentStage - 1]);
         if (spawnedEnemy == NULL) continue;
-        Enemy_Spawn(*spawnedEnemy, spawnPosition);
+
+        EnemyData* enemy = Enemy_SpawnInRoom(*spawnedEnemy, chunk);
+        // Room or enemy slots are full, the rest of the wave comes once these are cleared
+        if (!enemy) break;
+        chunk->totalEnemyCount--;
     }
 }
\ No newline at end of file
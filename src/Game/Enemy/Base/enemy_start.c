@@ -13,33 +13,23 @@
 #include <enemy_types.h>
 #include <app.h>
 #include <circle.h>
+#include <asset_loader.h>
+#include <stdlib.h>
+
+#define ENEMY_SPAWN_INDICATOR_PATH "Assets/Images/Tiles/enemy-spawn-indicator.png"
 
 /**
  * @brief [Data] Global arrays for enemy storage and spawn indicator texture
  */
-EnemyData enemies[ENEMY_MAX];
+EnemyData* enemies = NULL;
+int Enemy_Capacity = 0;
 EnemyData *enemyList[ENEMY_TYPE_COUNT];
-SDL_Texture* Enemy_spawnIndicator = NULL;
+SpriteRegion Enemy_spawnIndicator = {NULL};
 
 /**
- * @brief [Start] Initializes the enemy system
- * 
- * Prepares all enemy slots as inactive and loads necessary textures.
+ * @brief [Start] Fills enemyList with the data of every enemy type
  */
-void Enemy_Init() {
-    for (int i = 0; i < ENEMY_MAX; i++) {
-        enemies[i].state.isDead = true;
-    }
-    
-    Enemy_spawnIndicator = IMG_LoadTexture(app.resources.renderer, 
-        "Assets/Images/Tiles/enemy-spawn-indicator.png");
-    
-    if (!Enemy_spawnIndicator) {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, 
-            "Failed to load enemy spawn indicator texture: %s", IMG_GetError());
-    }
-
-    // Initialize enemy types
+static void Enemy_RegisterTypes() {
     enemyList[ENEMY_TYPE_ECHO] = &EchoData;
     enemyList[ENEMY_TYPE_KAMIKAZE] = &KamikazeData;
     enemyList[ENEMY_TYPE_RECHARGE] = &RechargeData;
@@ -51,10 +41,82 @@ void Enemy_Init() {
     enemyList[ENEMY_TYPE_JUGGERNAUT] = &JuggernautData;
     enemyList[ENEMY_TYPE_SENTRY] = &SentryData;
     enemyList[ENEMY_TYPE_LIBET] = &LibetData; // New boss enemy type
+}
+
+/**
+ * @brief [Start] Queues the enemy spritesheets for the startup asset loader
+ * 
+ * Covers every type's body and, for the types that carry one, its gun,
+ * which is only loaded when the first enemy of the type spawns.
+ */
+void Enemy_QueueAssets() {
+    Enemy_RegisterTypes();
+    AssetLoader_QueueImage(ENEMY_SPAWN_INDICATOR_PATH);
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        AssetLoader_QueueImage(enemyList[type]->animData.spritesheetPath);
+    }
+
+    const GunData* guns[] = {
+        &EchoConfigData.gun, &SentryConfigData.gun, &VantageConfigData.gun, &ProxyConfigData.gun,
+        &RadiusConfigData.gun, &JuggernautConfigData.gun, &TacticianConfigData.gun, &SabotConfigData.gun
+    };
+    for (int i = 0; i < (int) (sizeof(guns) / sizeof(guns[0])); i++) {
+        AssetLoader_QueueImage(guns[i]->animData.spritesheetPath);
+    }
+}
+
+/**
+ * @brief [Start] Initializes the enemy system
+ * 
+ * Allocates app.config.enemyCapacity enemy slots, prepares them as
+ * inactive and loads necessary textures.
+ */
+void Enemy_Init() {
+    Enemy_Capacity = app.config.enemyCapacity > 0 ? app.config.enemyCapacity : ENEMY_DEFAULT_CAPACITY;
+    enemies = calloc(Enemy_Capacity, sizeof(EnemyData));
+    bool allocated = enemies != NULL;
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        EnemyBuckets[type].indices = malloc(sizeof(int) * Enemy_Capacity);
+        if (!EnemyBuckets[type].indices) allocated = false;
+    }
+    if (!allocated) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, 
+            "Failed to allocate %d enemy slots", Enemy_Capacity);
+        // Without slots nothing ever spawns, so the buckets are never touched
+        free(enemies);
+        enemies = NULL;
+        for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+            free(EnemyBuckets[type].indices);
+            EnemyBuckets[type].indices = NULL;
+        }
+        Enemy_Capacity = 0;
+    }
+    SDL_Log("Enemy capacity: %d", Enemy_Capacity);
+
+    for (int i = 0; i < Enemy_Capacity; i++) {
+        enemies[i].state.isDead = true;
+    }
+    Enemy_ResetBuckets();
+    Enemy_InitHealthTexts();
+    
+    if (SpriteAtlas_Load(ENEMY_SPAWN_INDICATOR_PATH, &Enemy_spawnIndicator)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, 
+            "Failed to load enemy spawn indicator texture");
+    }
+
+    // Initialize enemy types
+    Enemy_RegisterTypes();
+
+    // Pack every enemy spritesheet into the sprite atlas up front, so spawning never loads images
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        SpriteRegion region;
+        SpriteAtlas_Load(enemyList[type]->animData.spritesheetPath, &region);
+    }
 
-    KamikazeConfigData.explosionIndicator = CreateCircleTexture(
+    KamikazeConfigData.explosionIndicator = GetCachedCircleTexture(
         KamikazeConfigData.explosionRadius,
-        (SDL_Color){255, 0, 0, 255}
+        (SDL_Color){255, 0, 0, 255},
+        0
     );
 
     KamikazeExplosionEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_Explosion);
@@ -72,9 +134,10 @@ void Enemy_Init() {
     SabotMuzzleFlashEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_MuzzleFlash);
     SabotCasingEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_PistolSMGCasing);
     SabotBulletFragmentsEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_BulletFragments);
-    SabotExplosionIndicator = CreateCircleTexture(  // Added this
+    SabotExplosionIndicator = GetCachedCircleTexture(  // Added this
         SabotConfigData.explosionRadius,
-        (SDL_Color){255, 0, 0, 255}
+        (SDL_Color){255, 0, 0, 255},
+        0
     );
     SabotExplosionEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_Explosion);  // Added this
     SabotExplosionEmitter->particleSpeed /= 2;  // Added this
@@ -91,7 +154,7 @@ void Enemy_Init() {
     TacticianCasingEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_PistolSMGCasing);
     TacticianBulletFragmentsEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_BulletFragments);
     TacticianBuffEffectEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_Fire);
-    TacticianBuffCircleTexture = CreateCircleOutlineTexture(
+    TacticianBuffCircleTexture = GetCachedCircleTexture(
         KamikazeConfigData.explosionRadius,
         (SDL_Color){255, 255, 0, 255},
         2
@@ -107,9 +170,10 @@ void Enemy_Init() {
     RadiusMuzzleFlashEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_MuzzleFlash);
     RadiusCasingEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_PistolSMGCasing);
     RadiusBulletFragmentsEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_BulletFragments);
-    RadiusExplosionIndicator = CreateCircleTexture(
+    RadiusExplosionIndicator = GetCachedCircleTexture(
         RadiusConfigData.explosionRadius,
-        (SDL_Color){255, 0, 0, 255}
+        (SDL_Color){255, 0, 0, 255},
+        0
     );
     RadiusExplosionEmitter = ParticleEmitter_CreateFromPreset(ParticleEmitter_Explosion);
     RadiusExplosionEmitter->particleSpeed /= 2;
@@ -12,10 +12,108 @@
 #include <enemy.h>
 #include <player.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <settings.h>
+#include <profiler.h>
 #include <player.h>
 
-UIElement* EnemyHealthTexts[ENEMY_MAX * 10] = {NULL};
+/**
+ * @brief Characters baked into the damage number atlas
+ */
+#define DAMAGE_NUMBER_GLYPHS "0123456789+-"
+#define DAMAGE_NUMBER_GLYPH_COUNT (sizeof(DAMAGE_NUMBER_GLYPHS) - 1)
+
+/**
+ * @brief How fast a damage number rises, in pixels per second
+ */
+#define DAMAGE_NUMBER_RISE_SPEED 60.0f
+
+/**
+ * @brief How fast a damage number fades, in alpha per second
+ */
+#define DAMAGE_NUMBER_FADE_SPEED 1000.0f
+
+/**
+ * @brief A single floating damage number
+ */
+typedef struct DamageNumber {
+    Vec2 position;          /**< Screen position of the top center of the text */
+    SDL_Color color;        /**< Tint applied to the white glyphs, alpha is faded over time */
+    float alpha;            /**< Current opacity, 0 means the slot is free */
+    char text[12];          /**< Sign and digits, e.g. "-25" */
+} DamageNumber;
+
+/**
+ * @brief Prebuilt texture holding every damage number glyph in white
+ */
+typedef struct DamageNumberAtlas {
+    SDL_Texture* texture;                           /**< The glyph atlas */
+    SDL_Rect glyphs[DAMAGE_NUMBER_GLYPH_COUNT];     /**< Source rect of each glyph */
+} DamageNumberAtlas;
+
+static DamageNumberAtlas DamageNumberGlyphs = {NULL};
+static DamageNumber* DamageNumbers = NULL;
+static int DamageNumberCapacity = 0;
+static int DamageNumberNext = 0;
+
+/**
+ * @brief [Start] Bakes the damage number glyphs into one texture
+ * 
+ * Each glyph is rendered once with the text font and packed in a row,
+ * so showing a number never touches SDL_ttf again.
+ * 
+ * @return int Status code (0 for success, non-zero for error)
+ */
+static int Enemy_BuildDamageNumberAtlas() {
+    SDL_Surface* glyphSurfaces[DAMAGE_NUMBER_GLYPH_COUNT] = {NULL};
+    int atlasWidth = 0;
+    int atlasHeight = 0;
+    for (int i = 0; i < DAMAGE_NUMBER_GLYPH_COUNT; i++) {
+        char glyph[2] = {DAMAGE_NUMBER_GLYPHS[i], '\0'};
+        glyphSurfaces[i] = TTF_RenderText_Solid(app.resources.textFont, glyph, (SDL_Color) {255, 255, 255, 255});
+        if (!glyphSurfaces[i]) continue;
+        DamageNumberGlyphs.glyphs[i] = (SDL_Rect) {atlasWidth, 0, glyphSurfaces[i]->w, glyphSurfaces[i]->h};
+        atlasWidth += glyphSurfaces[i]->w;
+        atlasHeight = MAX(atlasHeight, glyphSurfaces[i]->h);
+    }
+
+    SDL_Surface* atlas = NULL;
+    if (atlasWidth > 0) {
+        atlas = SDL_CreateRGBSurfaceWithFormat(0, atlasWidth, atlasHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    }
+    for (int i = 0; i < DAMAGE_NUMBER_GLYPH_COUNT; i++) {
+        if (!glyphSurfaces[i]) continue;
+        if (atlas) SDL_BlitSurface(glyphSurfaces[i], NULL, atlas, &DamageNumberGlyphs.glyphs[i]);
+        SDL_FreeSurface(glyphSurfaces[i]);
+    }
+    if (!atlas) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to build damage number atlas: %s", TTF_GetError());
+        return 1;
+    }
+
+    DamageNumberGlyphs.texture = SDL_CreateTextureFromSurface(app.resources.renderer, atlas);
+    SDL_FreeSurface(atlas);
+    if (!DamageNumberGlyphs.texture) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create damage number atlas: %s", SDL_GetError());
+        return 1;
+    }
+    SDL_SetTextureBlendMode(DamageNumberGlyphs.texture, SDL_BLENDMODE_BLEND);
+    PROFILER_COUNT(PROFILER_COUNTER_TEXTURES_CREATED, 1);
+    return 0;
+}
+
+/**
+ * @brief [Start] Allocates the damage number pool and its glyph atlas
+ * 
+ * Sized at ten numbers per enemy slot, so it scales with Enemy_Capacity.
+ */
+void Enemy_InitHealthTexts() {
+    DamageNumberCapacity = Enemy_Capacity * 10;
+    DamageNumbers = calloc(DamageNumberCapacity, sizeof(DamageNumber));
+    if (!DamageNumbers) DamageNumberCapacity = 0;
+    DamageNumberNext = 0;
+    Enemy_BuildDamageNumberAtlas();
+}
 
 /**
  * @brief [Utility] Applies damage to an enemy
@@ -42,79 +140,85 @@ void Enemy_TakeDamage(EnemyData* enemy, int damage) {
     );
 }
 
+/**
+ * @brief [Utility] Shows a floating damage number
+ * 
+ * Takes the next slot of the pool. When every slot is in use the oldest
+ * number is replaced, which is never noticed since it was nearly faded.
+ * 
+ * @param position World position of the top center of the number
+ * @param damage The damage taken, negative values are shown as green healing
+ */
 void Enemy_CreateHealthText(Vec2 position, int damage) {
-    UIElement* text;
-    char textBuffer[50];
+    if (DamageNumberCapacity == 0) return;
+    DamageNumber* number = &DamageNumbers[DamageNumberNext];
+    DamageNumberNext = (DamageNumberNext + 1) % DamageNumberCapacity;
+
     if (damage > 0) {
-        snprintf(textBuffer, sizeof(textBuffer), "-%d", damage);
-        text = UI_CreateText(
-            textBuffer, 
-            Vec2_ToSquareRect(
-                Camera_WorldVecToScreen(position), 
-                0
-            ),
-            (SDL_Color) {255, 255, 255, 255},
-            1.0f,
-            UI_TEXT_ALIGN_CENTER,
-            app.resources.textFont
-        );
+        snprintf(number->text, sizeof(number->text), "-%d", damage);
+        number->color = (SDL_Color) {255, 255, 255, 255};
     } else {
-        snprintf(textBuffer, sizeof(textBuffer), "+%d", -damage);
-        text = UI_CreateText(
-            textBuffer, 
-            Vec2_ToSquareRect(
-                Camera_WorldVecToScreen(
-                    (Vec2) {
-                        position.x, 
-                        position.y
-                    }
-                ), 
-                0
-            ),
-            (SDL_Color) {0, 255, 0, 255},
-            1.0f,
-            UI_TEXT_ALIGN_CENTER,
-            app.resources.textFont
-        );
-    }
-    
-    for (int i = 0; i < ENEMY_MAX * 10; i++) {
-        if (EnemyHealthTexts[i] == NULL) {
-            EnemyHealthTexts[i] = text;
-            break;
-        }
+        snprintf(number->text, sizeof(number->text), "+%d", -damage);
+        number->color = (SDL_Color) {0, 255, 0, 255};
     }
+    number->position = Camera_WorldVecToScreen(position);
+    number->alpha = 255;
 }
 
+/**
+ * @brief [PostUpdate] Moves and fades every damage number
+ */
 void Enemy_UpdateHealthTexts() {
-    for (int i = 0; i < ENEMY_MAX * 10; i++) {
-        if (EnemyHealthTexts[i] == NULL) continue;
-        EnemyHealthTexts[i]->rect.y -= 5.0f * Time->deltaTimeSeconds;
-        int nextAlpha = EnemyHealthTexts[i]->color.a - 1000 * Time->deltaTimeSeconds;
-        if (nextAlpha <= 0) {
-            nextAlpha = 0;
-            UI_DestroyText(EnemyHealthTexts[i]);
-            EnemyHealthTexts[i] = NULL;
-            continue;
-        }
-        UI_ChangeTextColor( 
-            EnemyHealthTexts[i], 
-            (SDL_Color) {
-                EnemyHealthTexts[i]->color.r,
-                EnemyHealthTexts[i]->color.g,
-                EnemyHealthTexts[i]->color.b,
-                nextAlpha
-            }
-        );
-        UI_UpdateText(EnemyHealthTexts[i]);
+    for (int i = 0; i < DamageNumberCapacity; i++) {
+        DamageNumber* number = &DamageNumbers[i];
+        if (number->alpha <= 0) continue;
+        number->position.y -= DAMAGE_NUMBER_RISE_SPEED * Time->deltaTimeSeconds;
+        number->alpha -= DAMAGE_NUMBER_FADE_SPEED * Time->deltaTimeSeconds;
+        if (number->alpha < 0) number->alpha = 0;
     }
 }
 
+/**
+ * @brief [Utility] Returns the atlas rect of a damage number glyph
+ */
+static SDL_Rect* Enemy_GetDamageNumberGlyph(char c) {
+    if (c >= '0' && c <= '9') return &DamageNumberGlyphs.glyphs[c - '0'];
+    if (c == '+') return &DamageNumberGlyphs.glyphs[10];
+    return &DamageNumberGlyphs.glyphs[11];
+}
+
+/**
+ * @brief [Render] Renders every damage number from the glyph atlas
+ * 
+ * Colors and fading are applied with texture color and alpha mods, so
+ * every glyph is a copy from the same texture and the draws are batched.
+ */
 void Enemy_RenderHealthTexts() {
     if (Settings_GetDamageNumbers() == false) return;
-    for (int i = 0; i < ENEMY_MAX * 10; i++) {
-        if (EnemyHealthTexts[i] == NULL) continue;
-        UI_RenderText(EnemyHealthTexts[i]);
+    if (!DamageNumberGlyphs.texture) return;
+    for (int i = 0; i < DamageNumberCapacity; i++) {
+        DamageNumber* number = &DamageNumbers[i];
+        if (number->alpha <= 0) continue;
+
+        int width = 0;
+        for (char* c = number->text; *c; c++) {
+            width += Enemy_GetDamageNumberGlyph(*c)->w;
+        }
+
+        SDL_SetTextureColorMod(DamageNumberGlyphs.texture, number->color.r, number->color.g, number->color.b);
+        SDL_SetTextureAlphaMod(DamageNumberGlyphs.texture, (Uint8) number->alpha);
+        SDL_Rect dest = {
+            (int) number->position.x - width / 2,
+            (int) number->position.y,
+            0,
+            0
+        };
+        for (char* c = number->text; *c; c++) {
+            SDL_Rect* glyph = Enemy_GetDamageNumberGlyph(*c);
+            dest.w = glyph->w;
+            dest.h = glyph->h;
+            SDL_RenderCopy(app.resources.renderer, DamageNumberGlyphs.texture, glyph, &dest);
+            dest.x += glyph->w;
+        }
     }
 }
-
@@ -14,51 +14,92 @@
 #include <enemy.h>
 #include <enemy_types.h>
 #include <time_system.h>
+#include <profiler.h>
+
+/**
+ * @brief [PostUpdate] Updates a single live enemy.
+ * 
+ * Handles special states like spawning, runs the enemy-specific update,
+ * then processes buffs, movement and death conditions.
+ * 
+ * @param enemy Pointer to the enemy to update
+ */
+static void Enemy_UpdateOne(EnemyData* enemy) {
+    if (enemy->state.isDead) return;  // Died earlier this frame, swept after the loop
+    if (enemy->state.isSpawning) {
+        Enemy_HandleSpawning(enemy);
+        return;
+    }
+    enemy->state.flip = enemy->state.direction.x > 0 ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
+    // Call enemy-specific update function if available
+    if (enemy->update) enemy->update(enemy);
+    if (enemy->state.isDead) return;
+    if (enemy->state.tacticianBuffTimeLeft > 0) {
+        TacticianBuffEffectEmitter->position = enemy->state.position;
+        ParticleEmitter_ActivateOnce(TacticianBuffEffectEmitter);
+        enemy->state.tacticianBuffTimeLeft -= Time->deltaTimeSeconds;
+    } else {
+        enemy->state.tacticianBuff = 1.0f;
+        enemy->state.tacticianBuffTimeLeft = 0;
+    }
+    Enemy_HandleMovement(enemy);
+    Animation_Update(enemy->resources.animation);
+
+    // Check if enemy should die
+    if (enemy->state.currentHealth <= 0) Enemy_HandleDeath(enemy);
+}
+
+/**
+ * @brief [PostUpdate] Updates every live enemy of one type.
+ * 
+ * Enemies spawned while the batch runs are appended to their bucket
+ * and still get updated this frame.
+ * 
+ * @param type The enemy type whose bucket should be updated
+ */
+void Enemy_UpdateType(EnemyType type) {
+    EnemyBucket* bucket = &EnemyBuckets[type];
+    for (int i = 0; i < bucket->count; i++) {
+        Enemy_UpdateOne(&enemies[bucket->indices[i]]);
+    }
+}
 
 /**
  * @brief [PostUpdate] Updates all active enemies in the game.
  * 
- * Main update loop for all enemies in the game. Skips dead enemies,
- * handles special states like spawning, and processes movement and death
- * conditions for each enemy.
+ * Main update loop for all enemies in the game. Walks the live enemy
+ * buckets one type at a time, so dead slots are never visited and each
+ * type's update runs as one batch.
  */
 void Enemy_Update() {
     ParticleEmitter_Render(TacticianBuffEffectEmitter);
-    for (int i = 0; i < ENEMY_MAX; i++) {
-        EnemyData* enemy = &enemies[i];
-        if (enemy->state.isDead) continue;  // Skip processing dead enemies
-        if (enemy->state.isSpawning) {
-            Enemy_HandleSpawning(enemy);
-            continue;
-        }
-        enemy->state.flip = enemy->state.direction.x > 0 ? SDL_FLIP_NONE : SDL_FLIP_HORIZONTAL;
-        // Call enemy-specific update function if available
-        if (enemy->update) enemy->update(enemy);
-        if (enemy->state.isDead) continue;
-        if (enemy->state.tacticianBuffTimeLeft > 0) {
-            TacticianBuffEffectEmitter->position = enemy->state.position;
-            ParticleEmitter_ActivateOnce(TacticianBuffEffectEmitter);
-            enemy->state.tacticianBuffTimeLeft -= Time->deltaTimeSeconds;
-        } else {
-            enemy->state.tacticianBuff = 1.0f;
-            enemy->state.tacticianBuffTimeLeft = 0;
-        }
-        Enemy_HandleMovement(enemy);
-        Animation_Update(enemy->resources.animation);
-
-        // Check if enemy should die
-        if (enemy->state.currentHealth <= 0) Enemy_HandleDeath(enemy);
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        if (EnemyBuckets[type].count == 0) continue;
+        PROFILER_ZONE_BEGIN(enemyList[type]->name);
+        Enemy_UpdateType(type);
+        PROFILER_ZONE_END();
     }
-    Enemy_UpdateHealthTexts();
-    ParticleEmitter_Update(KamikazeExplosionEmitter);
-    Proxy_UpdateParticles();
-    Sabot_UpdateParticles();
-    Vantage_UpdateParticles();
-    Tactician_UpdateParticles();
-    Sentry_UpdateParticles();
-    Radius_UpdateParticles();
-    Juggernaut_UpdateParticles();
-    Echo_UpdateParticles();  // Add Echo particles update
+    Enemy_CompactBuckets();
+    Enemy_UpdateEffects();
+}
+
+/**
+ * @brief [PostUpdate] Updates effects shared by all enemies of a type
+ * 
+ * Damage numbers and the per-type bullet/particle emitters, which
+ * also resolve enemy bullet collisions.
+ */
+void Enemy_UpdateEffects() {
+    PROFILE_CALL(Enemy_UpdateHealthTexts());
+    PROFILE_CALL(ParticleEmitter_Update(KamikazeExplosionEmitter));
+    PROFILE_CALL(Proxy_UpdateParticles());
+    PROFILE_CALL(Sabot_UpdateParticles());
+    PROFILE_CALL(Vantage_UpdateParticles());
+    PROFILE_CALL(Tactician_UpdateParticles());
+    PROFILE_CALL(Sentry_UpdateParticles());
+    PROFILE_CALL(Radius_UpdateParticles());
+    PROFILE_CALL(Juggernaut_UpdateParticles());
+    PROFILE_CALL(Echo_UpdateParticles());  // Add Echo particles update
 }
 
 /**
@@ -88,8 +129,8 @@ void Enemy_HandleSpawning(EnemyData* enemy) {
     enemy->resources.timer = NULL;
     enemy->state.isSpawning = false;
     
-    // Register collider and check for collisions at spawn point
-    Collider_Register(&enemy->state.collider, enemy);
+    // Switch the collider to its own layer and check for collisions at spawn point
+    enemy->state.collider.layer = enemyList[enemy->type]->state.collider.layer;
     ColliderCheckResult result;
     Collider_Check(&enemy->state.collider, &result);
     for (int i = 0; i < result.count; i++) {
@@ -98,9 +139,9 @@ void Enemy_HandleSpawning(EnemyData* enemy) {
             Player_TakeDamage(75);
             break;
         }
-        if (result.objects[i]->layer & (COLLISION_LAYER_ENVIRONMENT | COLLISION_LAYER_ENEMY | COLLISION_LAYER_PLAYER)) {
-            if (result.objects[i]->owner == enemy) continue;
-            // Kill enemy if spawning inside another object
+        // The spawn grid keeps spawn points clear of enemies, and the spawning layer
+        // keeps enemies from walking onto them, so only walls are left to check
+        if (result.objects[i]->layer & COLLISION_LAYER_ENVIRONMENT) {
             Enemy_HandleDeath(enemy);
             break;
         }
@@ -177,7 +218,7 @@ void Enemy_TryMove(EnemyData* enemy, Vec2 movement) {
     // Check if the new position is valid
     for (int i = 0 ; i < result.count; i++) {        
         if (result.objects[i]->layer & (
-            COLLISION_LAYER_PLAYER | COLLISION_LAYER_ENVIRONMENT | COLLISION_LAYER_ENEMY
+            COLLISION_LAYER_PLAYER | COLLISION_LAYER_ENVIRONMENT | COLLISION_LAYER_ENEMY | COLLISION_LAYER_ENEMY_SPAWNING
         )) 
         {   
             // Revert to old hitbox if collision detected
@@ -187,6 +228,7 @@ void Enemy_TryMove(EnemyData* enemy, Vec2 movement) {
     }
     // Apply movement if no collisions
     enemy->state.position = newPosition;
+    Chunk_MoveSpawnReservation(&enemy->state.spawnReservation, newPosition, size);
 }
 
 /**
@@ -194,7 +236,7 @@ void Enemy_TryMove(EnemyData* enemy, Vec2 movement) {
  * 
  * Sets health to 0, marks as dead, and removes collision.
  * Called when an enemy's health reaches zero or when they spawn inside
- * another object.
+ * a wall.
  * 
  * @param enemy Pointer to the enemy that died
  */
@@ -34,9 +34,9 @@ void Echo_Start(EnemyData* data) {
     AnimationData animData = ((EchoConfig*) data->config)->gun.animData;
 
     ((EchoConfig*) data->config)->lastPosition = data->state.position;
-    ((EchoConfig*) data->config)->directionChangeTime = RandFloat(1.0f, 3.0f);
+    ((EchoConfig*) data->config)->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 1.0f, 3.0f);
     ((EchoConfig*) data->config)->directionChangeTimer = 3.0f;
-    ((EchoConfig*) data->config)->shootTime = RandFloat(
+    ((EchoConfig*) data->config)->shootTime = Random_Float(RANDOM_STREAM_AI, 
         data->stats.attackCooldown / 2, data->stats.attackCooldown * 3 / 2
     );
     
@@ -34,10 +34,10 @@ void Juggernaut_Start(EnemyData* data) {
     AnimationData animData = ((JuggernautConfig*) data->config)->gun.animData;
 
     ((JuggernautConfig*) data->config)->lastPosition = data->state.position;
-    ((JuggernautConfig*) data->config)->directionChangeTime = RandFloat(1.0f, 3.0f);
+    ((JuggernautConfig*) data->config)->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 1.0f, 3.0f);
     ((JuggernautConfig*) data->config)->directionChangeTimer = 3.0f;
-    ((JuggernautConfig*) data->config)->walkDuration = RandFloat(2.0f, 4.0f);
-    ((JuggernautConfig*) data->config)->spinSpeedDegrees = RandFloat(360, 720);
+    ((JuggernautConfig*) data->config)->walkDuration = Random_Float(RANDOM_STREAM_AI, 2.0f, 4.0f);
+    ((JuggernautConfig*) data->config)->spinSpeedDegrees = Random_Float(RANDOM_STREAM_AI, 360, 720);
     
     GunData* gun = &((JuggernautConfig*) data->config)->gun;
     gun->resources.animation = Animation_Create(&animData);
@@ -123,7 +123,7 @@ void Juggernaut_Update(EnemyData* data) {
         // Normal movement behavior
         config->directionChangeTimer += Time->deltaTimeSeconds;
         if (config->directionChangeTimer >= config->directionChangeTime) {
-            config->directionChangeTime = RandFloat(0.5f, 1.0f);
+            config->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 0.5f, 1.0f);
             config->directionChangeTimer = 0;
 
             float distToPlayer = Vec2_Distance(player.state.position, data->state.position);
@@ -131,18 +131,18 @@ void Juggernaut_Update(EnemyData* data) {
             if (distToPlayer > 150) {
                 // Move toward player with some randomness
                 data->state.direction = Vec2_Normalize(Vec2_Subtract(player.state.position, data->state.position));
-                data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(-45, 45));
+                data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, -45, 45));
             } else {
                 // Circle around at medium range
                 data->state.direction = Vec2_Normalize(Vec2_Subtract(player.state.position, data->state.position));
-                data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(45, 135));
+                data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, 45, 135));
             }
         }
 
         if (config->timer >= config->walkDuration) {
             config->timer = 0;
             config->state = JUGGERNAUT_STATE_CHARGING;
-            config->walkDuration = RandFloat(2.0f, 4.0f);
+            config->walkDuration = Random_Float(RANDOM_STREAM_AI, 2.0f, 4.0f);
         }
         break;
 
@@ -170,7 +170,7 @@ void Juggernaut_Update(EnemyData* data) {
         if (config->timer >= config->enragedDuration) {
             config->timer = 0;
             config->state = JUGGERNAUT_STATE_WALKING;
-            config->walkDuration = RandFloat(2.0f, 4.0f);
+            config->walkDuration = Random_Float(RANDOM_STREAM_AI, 2.0f, 4.0f);
         }
         break;
 
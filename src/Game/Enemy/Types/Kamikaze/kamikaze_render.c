@@ -12,6 +12,7 @@
 #include <camera.h>
 #include <app.h>
 #include <circle.h>
+#include <sprite_batch.h>
 
 /**
  * @brief [Render] Renders the Echo enemy
@@ -29,6 +30,8 @@ void Kamikaze_Render(EnemyData* data) {
 
         // Set the opacity of explosion indicator
         int opacity = (50 * (config->explosionTimer - delay) / (config->explosionTime - delay));
+        // Drawn straight to the renderer, so the queued sprites must go first
+        SpriteBatch_Flush();
         SDL_SetTextureAlphaMod(config->explosionIndicator, opacity);
 
         // Render the explosion indicator
@@ -37,12 +37,12 @@ void Kamikaze_Update(EnemyData* data) {
         config->directionChangeTime -= Time->deltaTimeSeconds;
         if (config->directionChangeTime <= 0) {
             // Changes direction every 0.2 to 1 second
-            config->directionChangeTime = RandFloat(0.2f, 1.0f);
+            config->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 0.2f, 1.0f);
 
             // Randomly changes direction to 90 degrees left or right to the player
             // This is to make the kamikaze move in a random direction, but still towards the player
             data->state.direction = Vec2_Normalize(Vec2_Subtract(player.state.position, data->state.position));
-            data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(-90, 90));
+            data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, -90, 90));
         }
 
         if (data->stats.maxSpeed > 0) {
@@ -62,11 +62,11 @@ void Kamikaze_Update(EnemyData* data) {
         config->directionChangeTime -= Time->deltaTimeSeconds;
         if (config->directionChangeTime <= 0) {
             // Changes direction every 0.2 to 0.3 second
-            config->directionChangeTime = RandFloat(0.2f, 0.3f);
+            config->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 0.2f, 0.3f);
 
             // Randomly changes direction to 30 degrees left or right to the player
             data->state.direction = Vec2_Normalize(Vec2_Subtract(player.state.position, data->state.position));
-            data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(-30, 30));
+            data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, -30, 30));
         }
 
         if (Vec2_Distance(data->state.position, player.state.position) < 50) {
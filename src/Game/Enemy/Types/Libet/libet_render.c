@@ -5,28 +5,28 @@
 #include <app.h>
 
 void Enemy_RenderBoss() {
-    for (int i = 0; i < ENEMY_MAX; i++) {
-        if (enemies[i].state.isDead) continue;
-        if (enemies[i].state.isSpawning) continue;
-        if (enemies[i].type == ENEMY_TYPE_LIBET) {
-            // don't render if the enemy is not in the view
-            if (Camera_WorldRectIsOnScreen(enemies[i].state.collider.hitbox))
-            
-            Animation_Render(
-                enemies[i].resources.animation,
-                Camera_WorldVecToScreen(
-                    Vec2_ToCenteredPosition(
-                        enemies[i].state.position, 
-                        enemies[i].animData.spriteSize
-                    )
-                ),
-                enemies[i].animData.spriteSize,
-                0,
-                NULL,
-                enemies[i].state.flip
-            );
-            Libet_Render(&enemies[i]);
-        }
+    EnemyBucket* bucket = &EnemyBuckets[ENEMY_TYPE_LIBET];
+    for (int i = 0; i < bucket->count; i++) {
+        EnemyData* enemy = &enemies[bucket->indices[i]];
+        if (enemy->state.isDead) continue;
+        if (enemy->state.isSpawning) continue;
+        // don't render if the enemy is not in the view
+        if (Camera_WorldRectIsOnScreen(enemy->state.collider.hitbox))
+        
+        Animation_Render(
+            enemy->resources.animation,
+            Camera_WorldVecToScreen(
+                Vec2_ToCenteredPosition(
+                    enemy->state.position, 
+                    enemy->animData.spriteSize
+                )
+            ),
+            enemy->animData.spriteSize,
+            0,
+            NULL,
+            enemy->state.flip
+        );
+        Libet_Render(enemy);
     }
 }
 
@@ -47,6 +47,7 @@ void Libet_Render(EnemyData* data) {
             Lazer_Render(&libetLazers[i]);
         }
     }
+    Lazer_FlushBeams();
 
     LibetConfig* config = (LibetConfig*)data->config;
     static UIElement* bossText = NULL;
@@ -47,12 +47,12 @@ void Libet_Update(EnemyData* data) {
                 if (phase < 2) {
                     randomState = 0; // Favor explosion firing in early phases
                 } else {
-                    randomState = RandInt(0, 1); // Randomly choose between explosion and juggernaut
+                    randomState = Random_Int(RANDOM_STREAM_AI, 0, 1); // Randomly choose between explosion and juggernaut
                 }
             } else {
-                randomState = RandInt(2, 3); // Favor lazer or bullet hell
-                if (phase >= 1) randomState = RandInt(2, 4); // Add big lazer in later phases
-                if (phase >= 3) randomState = RandInt(2, 5); // Add room lazer in final phases
+                randomState = Random_Int(RANDOM_STREAM_AI, 2, 3); // Favor lazer or bullet hell
+                if (phase >= 1) randomState = Random_Int(RANDOM_STREAM_AI, 2, 4); // Add big lazer in later phases
+                if (phase >= 3) randomState = Random_Int(RANDOM_STREAM_AI, 2, 5); // Add room lazer in final phases
             }
             switch (randomState) {
                 case 0:
@@ -109,8 +109,8 @@ void Libet_Update(EnemyData* data) {
                     currentLazer = Vec2_Add(
                         Chunk_GetRoomTopLeft(Chunk_GetCurrentChunk(data->state.position)), 
                         (Vec2) {
-                            RandInt(0, 60),
-                            RandInt(-10, 50)
+                            Random_Int(RANDOM_STREAM_AI, 0, 60),
+                            Random_Int(RANDOM_STREAM_AI, -10, 50)
                         });
                     break;
             }
@@ -181,10 +181,10 @@ void Libet_Update(EnemyData* data) {
         juggernautFireRateTimer += Time->deltaTimeSeconds;
         if (juggernautFireRateTimer >= juggernautFireRate) {
             juggernautFireRateTimer = 0.0f;
-            Vec2 spawnPosition = Chunk_GetRandomTileCenterInRoom(
-                Chunk_GetCurrentChunk(player.state.position) // Assuming you have a function to get the current chunk
+            Enemy_SpawnInRoom(
+                *enemyList[ENEMY_TYPE_JUGGERNAUT],
+                Chunk_GetCurrentChunk(player.state.position)
             );
-            Enemy_Spawn(*enemyList[ENEMY_TYPE_JUGGERNAUT], spawnPosition);
             juggernautCounter++;
             if (juggernautCounter >= 5 || EnemyManage_CountEnemyInChunk(Chunk_GetCurrentChunk(data->state.position)) >= 2 + phase) {
                 juggernautCounter = 0;
@@ -201,10 +201,10 @@ void Libet_Update(EnemyData* data) {
         explosionFireRateTimer += Time->deltaTimeSeconds;
         if (explosionFireRateTimer >= explosionFireRate) {
             explosionFireRateTimer = 0.0f;
-            Vec2 spawnPosition = Chunk_GetRandomTileCenterInRoom(
-                Chunk_GetCurrentChunk(player.state.position) // Assuming you have a function to get the current chunk
+            Enemy_SpawnInRoom(
+                *enemyList[ENEMY_TYPE_KAMIKAZE],
+                Chunk_GetCurrentChunk(player.state.position)
             );
-            Enemy_Spawn(*enemyList[ENEMY_TYPE_KAMIKAZE], spawnPosition);
             explosionCounter++;
             if (explosionCounter >= 5 || EnemyManage_CountEnemyInChunk(Chunk_GetCurrentChunk(data->state.position)) >= 2 + phase * 2) {
                 explosionCounter = 0;
@@ -233,7 +233,7 @@ void Libet_Update(EnemyData* data) {
                 for (int i = 0; i < 40; i++) {
                     libetLazers[i].active = false;
                 }
-                for (int i = 0; i < ENEMY_MAX; i++) {
+                for (int i = 0; i < Enemy_Capacity; i++) {
                     EnemyData* enemy = &enemies[i];
                     if (enemy->state.isDead) continue;
                     enemy->state.currentHealth = 0;
@@ -35,9 +35,9 @@ void Proxy_Start(EnemyData* data) {
     AnimationData animData = ((ProxyConfig*) data->config)->gun.animData;
 
     ((ProxyConfig*) data->config)->lastPosition = data->state.position;
-    ((ProxyConfig*) data->config)->directionChangeTime = RandFloat(1.0f, 3.0f);
+    ((ProxyConfig*) data->config)->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 1.0f, 3.0f);
     ((ProxyConfig*) data->config)->directionChangeTimer = 3.0f;
-    ((ProxyConfig*) data->config)->shootTime = RandFloat(
+    ((ProxyConfig*) data->config)->shootTime = Random_Float(RANDOM_STREAM_AI, 
         data->stats.attackCooldown / 2, data->stats.attackCooldown * 3 / 2
     );
     GunData* gun = &((ProxyConfig*) data->config)->gun;
@@ -36,9 +36,9 @@ void Radius_Start(EnemyData* data) {
     AnimationData animData = ((RadiusConfig*) data->config)->gun.animData;
 
     ((RadiusConfig*) data->config)->lastPosition = data->state.position;
-    ((RadiusConfig*) data->config)->directionChangeTime = RandFloat(1.0f, 3.0f);
+    ((RadiusConfig*) data->config)->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 1.0f, 3.0f);
     ((RadiusConfig*) data->config)->directionChangeTimer = 3.0f;
-    ((RadiusConfig*) data->config)->shootTime = RandFloat(
+    ((RadiusConfig*) data->config)->shootTime = Random_Float(RANDOM_STREAM_AI, 
         data->stats.attackCooldown / 2, data->stats.attackCooldown * 3 / 2
     );
 
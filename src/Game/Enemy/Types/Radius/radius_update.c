@@ -112,14 +112,14 @@ void Radius_Update(EnemyData* data) {
 
     config->directionChangeTimer += Time->deltaTimeSeconds;
     if (config->directionChangeTimer >= config->directionChangeTime) {
-        config->directionChangeTime = RandFloat(0.5f, 1.0f);
+        config->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 0.5f, 1.0f);
         config->directionChangeTimer = 0;
         data->state.direction = Vec2_Normalize(Vec2_Subtract(player.state.position, data->state.position));
 
         if (Vec2_Distance(player.state.position, data->state.position) > 150) {
-            data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(-60, 60));
+            data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, -60, 60));
         } else {
-            data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(90, 270));
+            data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, 90, 270));
         }
     }
 
@@ -128,7 +128,7 @@ void Radius_Update(EnemyData* data) {
     config->shootTimer += Time->deltaTimeSeconds;
     if (config->shootTimer >= config->shootTime) {
         config->shootTimer = 0;
-        config->shootTime = RandFloat(
+        config->shootTime = Random_Float(RANDOM_STREAM_AI, 
             effectiveCooldown / 2, effectiveCooldown * 3 / 2
         );
 
@@ -173,7 +173,7 @@ void Radius_UpdateParticles() {
                     Player_TakeDamage(RadiusData.stats.damage);
                 }
             } else if (bullet->collider->collidesWith & COLLISION_LAYER_ENEMY) {
-                for (int j = 0; j < ENEMY_MAX; j++) {
+                for (int j = 0; j < Enemy_Capacity; j++) {
                     EnemyData* enemy = &enemies[j];
                     if (enemy->state.isDead) continue;
                     if (IsRectOverlappingCircle(
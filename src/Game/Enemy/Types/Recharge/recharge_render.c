@@ -11,6 +11,7 @@
 #include <camera.h>
 #include <app.h>
 #include <circle.h>
+#include <sprite_batch.h>
 #include <math.h>
 
 /**
@@ -27,6 +28,8 @@ void Recharge_Render(EnemyData* data) {
     if (config->isRecharging) {
         float timePassedRatio = config->timer / config->rechargeDuration;
         int alpha = 255 - 255 * timePassedRatio;
+        // Drawn straight to the renderer, so the queued sprites must go first
+        SpriteBatch_Flush();
         SDL_SetTextureAlphaMod(config->rechargeTexture, alpha);
     
         float radius = config->rechargeRadius * sqrt(timePassedRatio);
@@ -26,7 +26,7 @@
  */
 void Recharge_Start(EnemyData* data) {
     if (RechargeConfigData.rechargeTexture == NULL) {
-        RechargeConfigData.rechargeTexture = CreateCircleOutlineTexture(
+        RechargeConfigData.rechargeTexture = GetCachedCircleTexture(
             RechargeConfigData.rechargeRadius, 
             (SDL_Color) {0, 255, 0, 255},
             2
@@ -36,5 +36,5 @@ void Recharge_Start(EnemyData* data) {
     // Set up config pointer
     data->config = malloc(sizeof(RechargeConfig));
     memcpy(data->config, &RechargeConfigData, sizeof(RechargeConfig));
-    ((RechargeConfig*) data->config)->rechargeCooldown = RandFloat(1.0f,3.0f);
+    ((RechargeConfig*) data->config)->rechargeCooldown = Random_Float(RANDOM_STREAM_AI, 1.0f,3.0f);
 }
\ No newline at end of file
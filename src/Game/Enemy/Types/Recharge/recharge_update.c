@@ -25,23 +25,26 @@ Vec2 Recharge_GetDirection(EnemyData* data) {
     Vec2 closestEnemy = {0, 0};
     float closestDistance = 9999999.0f;
 
-    // Loop through every enemy in the enemy pool
-    for (int i = 0; i < ENEMY_MAX; i++) {
-        if (enemies[i].state.isDead || enemies[i].type == ENEMY_TYPE_RECHARGE) {
-            continue;
-        }
-        float distance = Vec2_Distance(enemies[i].state.position, data->state.position);
-        if (distance < closestDistance) {
-            closestDistance = distance;
-            closestEnemy = enemies[i].state.position;
+    // Loop through every live enemy, skipping the Recharge bucket entirely
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        if (type == ENEMY_TYPE_RECHARGE) continue;
+        EnemyBucket* bucket = &EnemyBuckets[type];
+        for (int i = 0; i < bucket->count; i++) {
+            EnemyData* enemy = &enemies[bucket->indices[i]];
+            if (enemy->state.isDead) continue;
+            float distance = Vec2_Distance(enemy->state.position, data->state.position);
+            if (distance < closestDistance) {
+                closestDistance = distance;
+                closestEnemy = enemy->state.position;
+            }
         }
     }
     if (closestDistance == 9999999.0f) {
-        return Vec2_RotateDegrees(Vec2_Up, RandFloat(-180, 180));
+        return Vec2_RotateDegrees(Vec2_Up, Random_Float(RANDOM_STREAM_AI, -180, 180));
     }
     Vec2 targetDirection = Vec2_Normalize(Vec2_Subtract(closestEnemy, data->state.position));
 
-    return Vec2_RotateDegrees(targetDirection, RandFloat(-45, 45));
+    return Vec2_RotateDegrees(targetDirection, Random_Float(RANDOM_STREAM_AI, -45, 45));
 }
 
 /**
@@ -57,7 +60,7 @@ void Recharge_Update(EnemyData* data) {
     config->directionChangeTimer += Time->deltaTimeSeconds;
     if (config->directionChangeTimer >= config->directionChangeTime) {
         config->directionChangeTimer = 0;
-        config->directionChangeTime = RandFloat(0.5f, 2.0f);
+        config->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 0.5f, 2.0f);
         data->state.direction = Recharge_GetDirection(data);
     }
 
@@ -69,7 +72,7 @@ void Recharge_Update(EnemyData* data) {
 
     if (config->isRecharging) {
         if (config->timer >= config->rechargeDuration) {
-            config->rechargeCooldown = RandFloat(1.0f, 3.0f);
+            config->rechargeCooldown = Random_Float(RANDOM_STREAM_AI, 1.0f, 3.0f);
             config->isRecharging = false;
             config->timer = 0;
         }
@@ -80,7 +83,7 @@ void Recharge_Update(EnemyData* data) {
             config->rechargePosition = data->state.position;
             Sound_Play_Effect(SOUND_ENEMY_HEALING);
 
-            for (int i = 0; i < ENEMY_MAX; i++) {
+            for (int i = 0; i < Enemy_Capacity; i++) {
                 if (enemies[i].state.isDead) {
                     continue;
                 }
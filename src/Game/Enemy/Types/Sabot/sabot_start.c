@@ -40,9 +40,9 @@ void Sabot_Start(EnemyData* data) {
     AnimationData animData = ((SabotConfig*) data->config)->gun.animData;
 
     ((SabotConfig*) data->config)->lastPosition = data->state.position;
-    ((SabotConfig*) data->config)->directionChangeTime = RandFloat(1.0f, 3.0f);
+    ((SabotConfig*) data->config)->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 1.0f, 3.0f);
     ((SabotConfig*) data->config)->directionChangeTimer = 3.0f;
-    ((SabotConfig*) data->config)->shootTime = RandFloat(
+    ((SabotConfig*) data->config)->shootTime = Random_Float(RANDOM_STREAM_AI, 
         data->stats.attackCooldown / 2, data->stats.attackCooldown * 3 / 2
     );
     GunData* gun = &((SabotConfig*) data->config)->gun;
@@ -13,6 +13,7 @@
 #include <app.h>
 #include <circle.h>
 #include <math.h>
+#include <lazer_system.h>
 
 /**
  * @brief [Render] Renders the Sentry enemy
@@ -57,42 +58,8 @@ void Sentry_RenderLaser(EnemyData* data) {
     SentryConfig* config = (SentryConfig*)data->config;
     if (!config) return;
 
-    // Laser width configuration
-    int lazerWidth = config->lazerWidth;
-    if (lazerWidth < 0) return; // Don't draw if laser width is negative
-    // Draw the red outer glow
-    SDL_SetRenderDrawColor(app.resources.renderer, 255, 0, 0, 255);
-    Vec2 lazerStart = Camera_WorldVecToScreen(config->lazerStart);
-    Vec2 lazerEnd = Camera_WorldVecToScreen(config->lazerEnd);
-    // Draw multiple red lines based on lazerWidth
-    for (int dx = -lazerWidth; dx <= lazerWidth; dx++) {
-        for (int dy = -lazerWidth; dy <= lazerWidth; dy++) {
-            // Skip the center point and points too far from center (for a circular appearance)
-            if ((dx == 0 && dy == 0) || (dx*dx + dy*dy > lazerWidth*lazerWidth)) {
-                continue;
-            }
-
-            SDL_RenderDrawLine(
-                app.resources.renderer, 
-                lazerStart.x + dx, 
-                lazerStart.y + dy, 
-                lazerEnd.x + dx, 
-                lazerEnd.y + dy
-            );
-        }
-    }
-
-    // Draw the white center line
-    if (lazerWidth > 0) {
-        SDL_SetRenderDrawColor(app.resources.renderer, 255, 255, 255, 255);
-    }
-    SDL_RenderDrawLine(
-        app.resources.renderer, 
-        lazerStart.x, 
-        lazerStart.y, 
-        lazerEnd.x, 
-        lazerEnd.y
-    );
+    // Queued with every other beam and drawn together in Enemy_RenderEffects()
+    Lazer_DrawBeam(config->lazerStart, config->lazerEnd, config->lazerWidth);
 }
 
 void Sentry_RenderParticles() {
@@ -34,7 +34,7 @@ void Sentry_Start(EnemyData* data) {
     AnimationData animData = ((SentryConfig*) data->config)->gun.animData;
 
     ((SentryConfig*) data->config)->lastPosition = data->state.position;
-    ((SentryConfig*) data->config)->idleTime = RandFloat(
+    ((SentryConfig*) data->config)->idleTime = Random_Float(RANDOM_STREAM_AI, 
         data->stats.attackCooldown / 2, data->stats.attackCooldown * 3 / 2
     );
 
@@ -124,7 +124,7 @@ void Sentry_Update(EnemyData* data) {
         }
 
         if (config->timer >= config->idleTime) {
-            config->idleTime = RandFloat(
+            config->idleTime = Random_Float(RANDOM_STREAM_AI, 
                 effectiveCooldown * 0.5f,
                 effectiveCooldown * 1.5f
             );
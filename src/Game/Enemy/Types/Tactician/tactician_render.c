@@ -7,6 +7,7 @@
 #include <camera.h>
 #include <app.h>
 #include <circle.h>
+#include <sprite_batch.h>
 #include <math.h>
 
 void Tactician_Render(EnemyData* data) {
@@ -25,6 +26,8 @@ void Tactician_Render(EnemyData* data) {
     if (config->state & TACTICIAN_STATE_COMMANDING) {
         float timePassedRatio = config->commandTimer / config->commandTime;
         int alpha = 255 - 255 * timePassedRatio;
+        // Drawn straight to the renderer, so the queued sprites must go first
+        SpriteBatch_Flush();
         SDL_SetTextureAlphaMod(TacticianBuffCircleTexture, alpha);
     
         float radius = config->commandRadius * sqrt(timePassedRatio);
@@ -37,9 +37,9 @@ void Tactician_Start(EnemyData* data) {
     AnimationData animData = ((TacticianConfig*) data->config)->gun.animData;
 
     ((TacticianConfig*) data->config)->lastPosition = data->state.position;
-    ((TacticianConfig*) data->config)->directionChangeTime = RandFloat(1.0f, 3.0f);
+    ((TacticianConfig*) data->config)->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 1.0f, 3.0f);
     ((TacticianConfig*) data->config)->directionChangeTimer = 3.0f;
-    ((TacticianConfig*) data->config)->shootTime = RandFloat(
+    ((TacticianConfig*) data->config)->shootTime = Random_Float(RANDOM_STREAM_AI, 
         data->stats.attackCooldown / 2, data->stats.attackCooldown * 3 / 2
     );
     GunData* gun = &((TacticianConfig*) data->config)->gun;
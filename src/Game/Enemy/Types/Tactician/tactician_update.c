@@ -61,7 +61,7 @@ void Tactician_Update(EnemyData* data) {
 
     config->directionChangeTimer += Time->deltaTimeSeconds;
     if (config->directionChangeTimer >= config->directionChangeTime) {
-        config->directionChangeTime = RandFloat(0.5f, 1.0f);
+        config->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 0.5f, 1.0f);
         config->directionChangeTimer = 0;
         
         // Prefer to maintain distance from player
@@ -69,9 +69,9 @@ void Tactician_Update(EnemyData* data) {
         float distFromPlayer = Vec2_Distance(data->state.position, player.state.position);
 
         if (distFromPlayer > 250) {
-            data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(-45, 45));
+            data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, -45, 45));
         } else {
-            data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(135, 225));
+            data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, 135, 225));
         }
     }
 
@@ -95,7 +95,7 @@ void Tactician_Update(EnemyData* data) {
         config->shootTimer += Time->deltaTimeSeconds;
         if (config->shootTimer >= config->shootTime) {
             config->shootTimer = 0;
-            config->shootTime = RandFloat(
+            config->shootTime = Random_Float(RANDOM_STREAM_AI, 
                 data->stats.attackCooldown / 2, data->stats.attackCooldown * 3 / 2
             );
             config->currentBurstCount = 0;
@@ -107,7 +107,7 @@ void Tactician_Update(EnemyData* data) {
     if (config->state & TACTICIAN_STATE_COMMANDING) {
         config->commandTimer += Time->deltaTimeSeconds;
         if (config->commandTimer >= config->commandTime) {
-            config->commandTime = RandFloat(3.0f, 5.0f);
+            config->commandTime = Random_Float(RANDOM_STREAM_AI, 3.0f, 5.0f);
             config->state &= ~TACTICIAN_STATE_COMMANDING;
         }
     } else {
@@ -118,7 +118,7 @@ void Tactician_Update(EnemyData* data) {
             config->state |= TACTICIAN_STATE_COMMANDING;
             Sound_Play_Effect(SOUND_BUFFING);
 
-            for (int i = 0; i < ENEMY_MAX; i++) {
+            for (int i = 0; i < Enemy_Capacity; i++) {
                 if (enemies[i].state.isDead) continue;
                 if (enemies[i].type == ENEMY_TYPE_TACTICIAN) continue;
                 if (Vec2_Distance(data->state.position, enemies[i].state.position) > config->commandRadius) continue;
@@ -34,9 +34,9 @@ void Vantage_Start(EnemyData* data) {
     AnimationData animData = ((VantageConfig*) data->config)->gun.animData;
 
     ((VantageConfig*) data->config)->lastPosition = data->state.position;
-    ((VantageConfig*) data->config)->directionChangeTime = RandFloat(1.0f, 3.0f);
+    ((VantageConfig*) data->config)->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 1.0f, 3.0f);
     ((VantageConfig*) data->config)->directionChangeTimer = 3.0f;
-    ((VantageConfig*) data->config)->shootTime = RandFloat(
+    ((VantageConfig*) data->config)->shootTime = Random_Float(RANDOM_STREAM_AI, 
         data->stats.attackCooldown / 2, data->stats.attackCooldown * 3 / 2
     );
     GunData* gun = &((VantageConfig*) data->config)->gun;
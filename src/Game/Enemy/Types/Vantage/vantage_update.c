@@ -76,24 +76,24 @@ void Vantage_Update(EnemyData* data) {
         data->stats.maxSpeed = 200;
         config->directionChangeTimer += Time->deltaTimeSeconds;
         if (config->directionChangeTimer >= config->directionChangeTime) {
-            config->directionChangeTime = RandFloat(0.5f, 1.0f);
+            config->directionChangeTime = Random_Float(RANDOM_STREAM_AI, 0.5f, 1.0f);
             config->directionChangeTimer = 0;
 
             // Circle around the player
             float distToPlayer = Vec2_Distance(data->state.position, player.state.position);
             if (distToPlayer > 200) {
                 data->state.direction = Vec2_Normalize(Vec2_Subtract(player.state.position, data->state.position));
-                data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(-60, 60));
+                data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, -60, 60));
             } else {
                 data->state.direction = Vec2_Normalize(Vec2_Subtract(player.state.position, data->state.position));
-                data->state.direction = Vec2_RotateDegrees(data->state.direction, RandFloat(90, 270));
+                data->state.direction = Vec2_RotateDegrees(data->state.direction, Random_Float(RANDOM_STREAM_AI, 90, 270));
             }
         }
 
         config->shootTimer += Time->deltaTimeSeconds;
         if (config->shootTimer >= config->shootTime) {
             config->shootTimer = 0;
-            config->shootTime = RandFloat(
+            config->shootTime = Random_Float(RANDOM_STREAM_AI, 
                 effectiveCooldown / 2, effectiveCooldown * 3 / 2
             );
             config->aiming = true;
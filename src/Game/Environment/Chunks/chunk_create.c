@@ -13,6 +13,7 @@
 #include <enemy.h>
 #include <enemy_types.h>
 #include <random.h>
+#include <profiler.h>
 
 /**
  * [Utility] Generates a complete chunk with tiles, hallways, and colliders
@@ -20,15 +21,15 @@
  * Creates a fully-formed environment chunk with all necessary components
  * including floor tiles, walls, hallways, and collision boxes.
  * 
+ * @param chunk Pointer to the chunk to fill, generated in place
  * @param position World position of the chunk
  * @param roomType Type of room to generate (start, normal, boss, end)
  * @param roomSize Size of the room in tiles
  * @param floorPattern Pattern to use for floor tiles
  * @param hallways Configuration of hallways connected to this room
- * @return EnvironmentChunk The fully generated chunk
  */
-EnvironmentChunk Chunk_GenerateTiles(Vec2 position, RoomType roomType, Vec2 roomSize, RoomFloorPattern floorPattern, RoomHallways hallways) {
-    EnvironmentChunk chunk = {
+void Chunk_GenerateTiles(EnvironmentChunk* chunk, Vec2 position, RoomType roomType, Vec2 roomSize, RoomFloorPattern floorPattern, RoomHallways hallways) {
+    *chunk = (EnvironmentChunk) {
         .position = position,
         .roomSize = roomSize,
         .hallways = hallways,
@@ -37,33 +38,33 @@ EnvironmentChunk Chunk_GenerateTiles(Vec2 position, RoomType roomType, Vec2 room
     };
 
 
-    Chunk_GenerateFloorTiles(&chunk);
-    Chunk_GenerateWallTiles(&chunk);
-    Chunk_GenerateHallways(&chunk);
-    Chunk_GenerateHallwayWallTiles(&chunk);
-    Chunk_GenerateColliders(&chunk);
-    return chunk;
+    Chunk_GenerateFloorTiles(chunk);
+    Chunk_GenerateWallTiles(chunk);
+    Chunk_GenerateHallways(chunk);
+    Chunk_GenerateHallwayWallTiles(chunk);
+    Chunk_GenerateColliders(chunk);
 }
 
 /**
  * [Utility] Regenerates all tiles for an existing chunk
  * 
  * Clears all existing tiles and colliders from a chunk and regenerates them,
- * useful when hallway configurations change or room state changes.
+ * useful when the room size or hallway configuration changes. Doors that
+ * were closed are closed again. To only open or close the doors, use
+ * Chunk_SetDoorsClosed() instead.
  * 
  * @param chunk Pointer to the chunk to regenerate
  */
 void Chunk_GenerateTilesButVoid(EnvironmentChunk* chunk) {
-    for (int i = 0; i < chunk->colliderCount; i++) {
-        Collider_Reset(chunk->colliders[i]);
-        free(chunk->colliders[i]);
-    }
-    chunk->colliderCount = 0;
+    Chunk_ReleaseColliders(chunk);
+    RoomHallways closedDoors = chunk->doorsClosed;
+    chunk->doorsClosed = HALLWAY_NONE;
     Chunk_GenerateFloorTiles(chunk);
     Chunk_GenerateWallTiles(chunk);
     Chunk_GenerateHallways(chunk);
     Chunk_GenerateHallwayWallTiles(chunk);
     Chunk_GenerateColliders(chunk);
+    Chunk_SetDoorsClosed(chunk, closedDoors);
 }
 
 /**
@@ -79,6 +80,10 @@ void Chunk_GenerateFloorTiles(EnvironmentChunk* chunk) {
     int roomStartY = (CHUNK_SIZE_TILE - chunk->roomSize.y) / 2;
     int roomEndX = roomStartX + chunk->roomSize.x;
     int roomEndY = roomStartY + chunk->roomSize.y;
+    // Seeded from the room's own seed so regenerating a room keeps its floor,
+    // and safe to run on the map worker
+    RandomState random;
+    RandomState_Seed(&random, chunk->floorSeed, RANDOM_STREAM_MAP);
 
     // Generate floor tiles
     for (int x = 0; x < CHUNK_SIZE_TILE; x++) {
@@ -88,7 +93,7 @@ void Chunk_GenerateFloorTiles(EnvironmentChunk* chunk) {
             if (x >= roomStartX && x < roomEndX && y >= roomStartY && y < roomEndY) {
                 switch (chunk->floorPattern) {
                     case ROOM_FLOOR_PATTERN_RANDOM:
-                        type = RandInt(TILE_FLOOR_1, TILE_FLOOR_VENT_3);
+                        type = RandomState_Int(&random, TILE_FLOOR_1, TILE_FLOOR_VENT_3);
                         break;
                     case ROOM_FLOOR_PATTERN_1:
                         type = TILE_FLOOR_1;
@@ -221,8 +226,8 @@ void Chunk_GenerateHallwayWallTiles(EnvironmentChunk* chunk) {
 /**
  * [Utility] Generates collision boxes for a chunk
  * 
- * Creates colliders for walls and hallways, as well as trigger
- * zones for room and hallway detection.
+ * Creates the wall colliders from the solid tiles, trigger zones for room
+ * and hallway detection, and an open door collider across each hallway.
  * 
  * @param chunk Pointer to the chunk
  */
@@ -231,7 +236,12 @@ void Chunk_GenerateColliders(EnvironmentChunk* chunk) {
     int roomStartY = (CHUNK_SIZE_TILE - chunk->roomSize.y) / 2;
     int roomEndX = roomStartX + chunk->roomSize.x;
     int roomEndY = roomStartY + chunk->roomSize.y;
+    for (int i = 0; i < CHUNK_DOOR_COUNT; i++) {
+        chunk->doorColliders[i] = NULL;
+        chunk->hallwayTriggers[i] = NULL;
+    }
 
+    Chunk_GenerateWallColliders(chunk);
     Chunk_AddRoomTrigger(
         (Vec2) {roomStartX, roomStartY}, 
         (Vec2) {roomEndX - 1, roomEndY - 1}, 
@@ -247,136 +257,60 @@ void Chunk_GenerateColliders(EnvironmentChunk* chunk) {
     }
     if (chunk->hallways & HALLWAY_UP) {
         Chunk_AddHallwayTrigger(
+            HALLWAY_UP,
             (Vec2) {HALLWAY_START, 0}, 
             (Vec2) {HALLWAY_END - 1, roomStartY - 1}, 
             chunk
         );
-        Chunk_AddWallCollider(
-            (Vec2) {HALLWAY_START - 1, 0}, 
-            (Vec2) {HALLWAY_START - 1, roomStartY - 3}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {HALLWAY_END, 0}, 
-            (Vec2) {HALLWAY_END, roomStartY - 3}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {roomStartX, roomStartY - 2}, 
-            (Vec2) {HALLWAY_START - 1, roomStartY - 2}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {HALLWAY_END, roomStartY - 2}, 
-            (Vec2) {roomEndX - 1, roomStartY - 2}, 
-            chunk
-        );
-    } else {
-        Chunk_AddWallCollider(
-            (Vec2) {roomStartX, roomStartY - 2},
-            (Vec2) {roomEndX - 1, roomStartY - 2},
+        Chunk_AddDoorCollider(
+            HALLWAY_UP,
+            (Vec2) {HALLWAY_START, roomStartY - 2},
+            (Vec2) {HALLWAY_END - 1, roomStartY - 2},
             chunk
         );
     }
 
     if (chunk->hallways & HALLWAY_LEFT) {
         Chunk_AddHallwayTrigger(
+            HALLWAY_LEFT,
             (Vec2) {0, HALLWAY_START}, 
             (Vec2) {roomStartX - 1, HALLWAY_END - 1}, 
             chunk
         );
-        Chunk_AddWallCollider(
-            (Vec2) {0 , HALLWAY_START - 2}, 
-            (Vec2) {roomStartX - 1, HALLWAY_START - 2}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {0 , HALLWAY_END}, 
-            (Vec2) {roomStartX - 1, HALLWAY_END}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {roomStartX - 1, roomStartY - 1}, 
-            (Vec2) {roomStartX - 1, HALLWAY_START - 3}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {roomStartX - 1, HALLWAY_END + 1}, 
-            (Vec2) {roomStartX - 1, roomEndY - 1}, 
-            chunk
-        );
-    } else {
-        Chunk_AddWallCollider(
-            (Vec2) {roomStartX - 1, roomStartY - 1},
-            (Vec2) {roomStartX - 1, roomEndY - 1},
+        Chunk_AddDoorCollider(
+            HALLWAY_LEFT,
+            (Vec2) {roomStartX - 1, HALLWAY_START - 1},
+            (Vec2) {roomStartX - 1, HALLWAY_END - 1},
             chunk
         );
     }
 
     if (chunk->hallways & HALLWAY_DOWN) {
         Chunk_AddHallwayTrigger(
+            HALLWAY_DOWN,
             (Vec2) {HALLWAY_START, roomEndY}, 
             (Vec2) {HALLWAY_END - 1, CHUNK_SIZE_TILE - 1}, 
             chunk
         );
-        Chunk_AddWallCollider(
-            (Vec2) {roomStartX, roomEndY}, 
-            (Vec2) {HALLWAY_START - 2, roomEndY}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {HALLWAY_START - 1, roomEndY}, 
-            (Vec2) {HALLWAY_START - 1, CHUNK_SIZE_TILE - 1}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {HALLWAY_END, roomEndY}, 
-            (Vec2) {HALLWAY_END, CHUNK_SIZE_TILE - 1}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {HALLWAY_END + 1, roomEndY}, 
-            (Vec2) {roomEndX - 1, roomEndY}, 
-            chunk
-        );
-    } else {
-        Chunk_AddWallCollider(
-            (Vec2) {roomStartX, roomEndY},
-            (Vec2) {roomEndX - 1, roomEndY},
+        Chunk_AddDoorCollider(
+            HALLWAY_DOWN,
+            (Vec2) {HALLWAY_START, roomEndY},
+            (Vec2) {HALLWAY_END - 1, roomEndY},
             chunk
         );
     }
 
     if (chunk->hallways & HALLWAY_RIGHT) {
         Chunk_AddHallwayTrigger(
+            HALLWAY_RIGHT,
             (Vec2) {roomEndX, HALLWAY_START}, 
             (Vec2) {CHUNK_SIZE_TILE - 1, HALLWAY_END - 1}, 
             chunk
         );
-        Chunk_AddWallCollider(
-            (Vec2) {roomEndX, roomStartY - 1}, 
-            (Vec2) {roomEndX, HALLWAY_START - 3}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {roomEndX, HALLWAY_START - 2}, 
-            (Vec2) {CHUNK_SIZE_TILE - 1, HALLWAY_START - 2}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {roomEndX, HALLWAY_END}, 
-            (Vec2) {CHUNK_SIZE_TILE - 1, HALLWAY_END}, 
-            chunk
-        );
-        Chunk_AddWallCollider(
-            (Vec2) {roomEndX, HALLWAY_END + 1}, 
-            (Vec2) {roomEndX, roomEndY - 1}, 
-            chunk
-        );
-    } else {
-        Chunk_AddWallCollider(
-            (Vec2) {roomEndX, roomStartY - 1},
-            (Vec2) {roomEndX, roomEndY - 1},
+        Chunk_AddDoorCollider(
+            HALLWAY_RIGHT,
+            (Vec2) {roomEndX, HALLWAY_START - 1},
+            (Vec2) {roomEndX, HALLWAY_END - 1},
             chunk
         );
     }
@@ -385,7 +319,8 @@ void Chunk_GenerateColliders(EnvironmentChunk* chunk) {
 /**
  * [Utility] Adds a wall collider to a chunk
  * 
- * Creates a physical collision box for walls at the specified location.
+ * Creates a physical collision box at the specified location, for the ones
+ * that do not follow the tiles like doors and the exit.
  * 
  * @param startTile Starting tile position of the wall
  * @param endTile Ending tile position of the wall
@@ -398,6 +333,7 @@ void Chunk_AddWallCollider(Vec2 startTile, Vec2 endTile, EnvironmentChunk* chunk
     Vec2 colliderSizePixels = Vec2_Multiply(colliderSizeTiles, TILE_SIZE_PIXELS);
     
     Collider* collider = malloc(sizeof(Collider));
+    PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 1);
     collider->hitbox = (SDL_Rect) {
         startPixel.x + chunk->position.x * CHUNK_SIZE_PIXEL,
         startPixel.y + chunk->position.y * CHUNK_SIZE_PIXEL,
@@ -458,6 +394,7 @@ void Chunk_AddRoomTrigger(Vec2 startTile, Vec2 endTile, EnvironmentChunk* chunk)
     Vec2 colliderSizePixels = Vec2_Multiply(colliderSizeTiles, TILE_SIZE_PIXELS);
     
     Collider* collider = malloc(sizeof(Collider));
+    PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 1);
     collider->hitbox = (SDL_Rect) {
         startPixel.x + chunk->position.x * CHUNK_SIZE_PIXEL,
         startPixel.y + chunk->position.y * CHUNK_SIZE_PIXEL,
@@ -475,17 +412,19 @@ void Chunk_AddRoomTrigger(Vec2 startTile, Vec2 endTile, EnvironmentChunk* chunk)
  * 
  * Creates a trigger zone that detects when the player is inside a hallway.
  * 
+ * @param hallway The hallway the trigger covers
  * @param startTile Starting tile position
  * @param endTile Ending tile position
  * @param chunk Pointer to the chunk
  */
-void Chunk_AddHallwayTrigger(Vec2 startTile, Vec2 endTile, EnvironmentChunk* chunk) {
+void Chunk_AddHallwayTrigger(RoomHallways hallway, Vec2 startTile, Vec2 endTile, EnvironmentChunk* chunk) {
     Vec2 startPixel = Vec2_Multiply(startTile, TILE_SIZE_PIXELS);
     Vec2 colliderSizeTiles = Vec2_Subtract(endTile, startTile);
     Vec2_Increment(&colliderSizeTiles, (Vec2) {1, 1});
     Vec2 colliderSizePixels = Vec2_Multiply(colliderSizeTiles, TILE_SIZE_PIXELS);
     
     Collider* collider = malloc(sizeof(Collider));
+    PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 1);
     collider->hitbox = (SDL_Rect) {
         startPixel.x + chunk->position.x * CHUNK_SIZE_PIXEL,
         startPixel.y + chunk->position.y * CHUNK_SIZE_PIXEL,
@@ -496,6 +435,9 @@ void Chunk_AddHallwayTrigger(Vec2 startTile, Vec2 endTile, EnvironmentChunk* chu
     collider->layer = COLLISION_LAYER_TRIGGER;
     Collider_Register(collider, &Chunk_HandlePlayerInsideHallway);
     chunk->colliders[chunk->colliderCount++] = collider;
+
+    int index = Chunk_GetDoorIndex(hallway);
+    if (index >= 0) chunk->hallwayTriggers[index] = collider;
 }
 
 /**
@@ -0,0 +1,132 @@
+/**
+ * @file chunk_doors.c
+ * @brief Opens and closes the doors of a room's hallways
+ *
+ * Every hallway of a room has a door where it meets the room wall: a strip
+ * of tiles and one wall collider. Closing the room for combat only rewrites
+ * those strips and switches the colliders on, instead of regenerating every
+ * tile and collider of the chunk.
+ *
+ * @author Mango
+ * @date 2025-04-18
+ */
+
+#include <chunks.h>
+
+/**
+ * [Utility] Gets the slot of a door in EnvironmentChunk.doorColliders and hallwayTriggers
+ *
+ * @param door A single hallway direction
+ * @return int The slot, or -1 if door is not a single direction
+ */
+int Chunk_GetDoorIndex(RoomHallways door) {
+    switch (door) {
+        case HALLWAY_UP:    return 0;
+        case HALLWAY_DOWN:  return 1;
+        case HALLWAY_LEFT:  return 2;
+        case HALLWAY_RIGHT: return 3;
+        default:            return -1;
+    }
+}
+
+/**
+ * [Utility] Adds the collider of a hallway's door to a chunk
+ *
+ * The collider is registered straight away but stays on no layer, so
+ * nothing collides with it until the door is closed.
+ *
+ * @param door The hallway the door belongs to
+ * @param startTile Starting tile of the door
+ * @param endTile Ending tile of the door
+ * @param chunk Pointer to the chunk
+ */
+void Chunk_AddDoorCollider(RoomHallways door, Vec2 startTile, Vec2 endTile, EnvironmentChunk* chunk) {
+    int index = Chunk_GetDoorIndex(door);
+    if (index < 0) return;
+    Chunk_AddWallCollider(startTile, endTile, chunk);
+    Collider* collider = chunk->colliders[chunk->colliderCount - 1];
+    collider->layer = COLLISION_LAYER_NONE;
+    chunk->doorColliders[index] = collider;
+}
+
+/**
+ * @brief [Utility] Rewrites the tiles of one door
+ *
+ * Closed doors use the tiles the room wall has where there is no hallway,
+ * open doors the hallway floor and the ends of the hallway walls.
+ *
+ * @param chunk Pointer to the chunk
+ * @param door The hallway the door belongs to
+ * @param closed Whether the door is closed
+ */
+static void Chunk_SetDoorTiles(EnvironmentChunk* chunk, RoomHallways door, bool closed) {
+    int roomStartX = ROOM_STARTX(chunk->roomSize);
+    int roomStartY = ROOM_STARTY(chunk->roomSize);
+    int roomEndX = ROOM_ENDX(chunk->roomSize);
+    int roomEndY = ROOM_ENDY(chunk->roomSize);
+    EnvironmentTile floor = Tile_Create(TILE_FLOOR_1, TILE_ROTATE_NONE);
+
+    switch (door) {
+        case HALLWAY_UP:
+            for (int x = HALLWAY_START; x < HALLWAY_END; x++) {
+                chunk->tiles[x][roomStartY - 1] = closed ? Tile_Create(TILE_WALL_BOTTOM, TILE_ROTATE_NONE) : floor;
+                chunk->tiles[x][roomStartY - 2] = closed ? Tile_Create(TILE_WALL_TOP, TILE_ROTATE_NONE) : floor;
+                chunk->tiles[x][roomStartY - 3] = closed ? Tile_Create(TILE_WALL_SIDE_BORDER, TILE_ROTATE_NONE) : floor;
+            }
+            break;
+        case HALLWAY_DOWN:
+            for (int x = HALLWAY_START; x < HALLWAY_END; x++) {
+                chunk->tiles[x][roomEndY] = closed ? Tile_Create(TILE_VOID, TILE_ROTATE_NONE) : floor;
+            }
+            break;
+        case HALLWAY_LEFT:
+        case HALLWAY_RIGHT: {
+            int x = door == HALLWAY_LEFT ? roomStartX - 1 : roomEndX;
+            TileRotation rotation = door == HALLWAY_LEFT ? TILE_ROTATE_COUNTERCLOCKWISE : TILE_ROTATE_CLOCKWISE;
+            for (int y = HALLWAY_START - 2; y < HALLWAY_END; y++) {
+                if (closed) {
+                    chunk->tiles[x][y] = Tile_Create(TILE_WALL_SIDE_BORDER, rotation);
+                } else if (y == HALLWAY_START - 2) {
+                    chunk->tiles[x][y] = Tile_Create(TILE_WALL_TOP, TILE_ROTATE_NONE);
+                } else if (y == HALLWAY_START - 1) {
+                    chunk->tiles[x][y] = Tile_Create(TILE_WALL_BOTTOM, TILE_ROTATE_NONE);
+                } else {
+                    chunk->tiles[x][y] = floor;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/**
+ * [Utility] Opens or closes the doors of a room's hallways
+ *
+ * Only doors whose state changes are touched: their tile strip is rewritten
+ * and their collider moved on or off the environment layer. The hallway
+ * trigger is switched off while its door is closed, since the player can
+ * still stand on the wall tile in front of the UP door, which the trigger
+ * reaches, and being inside a hallway holds back the waves.
+ *
+ * @param chunk Pointer to the chunk
+ * @param closed The hallways whose door should be closed, the others are opened
+ */
+void Chunk_SetDoorsClosed(EnvironmentChunk* chunk, RoomHallways closed) {
+    closed &= chunk->hallways;
+    RoomHallways changed = closed ^ chunk->doorsClosed;
+    for (int i = 0; i < CHUNK_DOOR_COUNT; i++) {
+        RoomHallways door = 1 << i;
+        if (!(changed & door)) continue;
+
+        bool close = closed & door;
+        Chunk_SetDoorTiles(chunk, door, close);
+        int index = Chunk_GetDoorIndex(door);
+        Collider* collider = chunk->doorColliders[index];
+        if (collider) collider->layer = close ? COLLISION_LAYER_ENVIRONMENT : COLLISION_LAYER_NONE;
+        Collider* trigger = chunk->hallwayTriggers[index];
+        if (trigger) trigger->layer = close ? COLLISION_LAYER_NONE : COLLISION_LAYER_TRIGGER;
+    }
+    chunk->doorsClosed = closed;
+}
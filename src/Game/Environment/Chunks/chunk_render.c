@@ -12,9 +12,6 @@
 #include <chunks.h>
 
 void Chunk_Render(const EnvironmentChunk* chunk) {
-    // 2. Skip empty chunks entirely
-    if (chunk->empty) return;
-    
     // 3. Pre-compute world position to avoid redundant calculations
     int chunkWorldX = chunk->position.x * CHUNK_SIZE_TILE;
     int chunkWorldY = chunk->position.y * CHUNK_SIZE_TILE;
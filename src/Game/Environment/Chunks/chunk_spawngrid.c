@@ -0,0 +1,359 @@
+/**
+ * @file chunk_spawngrid.c
+ * @brief Free-tile occupancy grids for enemy spawn points
+ *
+ * Every room enemies spawn into gets a grid of its interior tiles with a
+ * free list of the tiles nobody holds. The grid is built the first time
+ * the room is spawned into, taking out the tiles under the enemies already
+ * there. From then on it is only updated: a spawn reserves the tiles under
+ * the new enemy, the reservation follows the enemy whenever it moves onto
+ * other tiles, and it is given back once the enemy has died and is swept
+ * out of its bucket. Drawing a spawn point is a pick from the free list
+ * plus a check against the player, so a new enemy never lands on a wall,
+ * the player or another enemy.
+ *
+ * @author Mango
+ * @date 2025-04-13
+ */
+
+#include <maps.h>
+#include <enemy.h>
+#include <player.h>
+#include <random.h>
+
+#define SPAWN_GRID_TILES (CHUNK_SIZE_TILE * CHUNK_SIZE_TILE)
+
+/**
+ * @brief Random picks tried before falling back to a scan of the free list
+ */
+#define SPAWN_GRID_RANDOM_ATTEMPTS 8
+
+/**
+ * @brief Occupancy grid of one room
+ */
+typedef struct ChunkSpawnGrid {
+    EnvironmentChunk* chunk;            /**< Room the grid was built for, NULL for an unused grid */
+    Uint32 id;                          /**< Never reused, so reservations of a replaced grid are ignored */
+    int freeTiles[SPAWN_GRID_TILES];    /**< Free tiles, packed as y * CHUNK_SIZE_TILE + x */
+    int freeIndex[SPAWN_GRID_TILES];    /**< Position of each tile inside freeTiles, -1 if not free */
+    Uint8 holders[SPAWN_GRID_TILES];    /**< Reservations covering each tile */
+    bool interior[SPAWN_GRID_TILES];    /**< Whether enemies can spawn on the tile at all */
+    int freeCount;                      /**< Number of entries in freeTiles */
+} ChunkSpawnGrid;
+
+static ChunkSpawnGrid spawnGrids[CHUNK_SPAWN_GRIDS];
+static Uint32 nextSpawnGridId = 1;
+static int nextSpawnGridSlot = 0;
+
+/**
+ * @brief [Utility] Gets the grid a reservation was made in
+ *
+ * @return ChunkSpawnGrid* The grid, NULL if it has been replaced since
+ */
+static ChunkSpawnGrid* Chunk_GetReservationGrid(const ChunkSpawnReservation* reservation) {
+    if (reservation->gridId == 0 || reservation->grid >= CHUNK_SPAWN_GRIDS) return NULL;
+    ChunkSpawnGrid* grid = &spawnGrids[reservation->grid];
+    return grid->id == reservation->gridId ? grid : NULL;
+}
+
+/**
+ * @brief [Utility] Checks whether a chunk-local tile is free
+ */
+static bool Chunk_SpawnTileIsFree(const ChunkSpawnGrid* grid, int x, int y) {
+    if (x < 0 || x >= CHUNK_SIZE_TILE || y < 0 || y >= CHUNK_SIZE_TILE) return false;
+    return grid->freeIndex[y * CHUNK_SIZE_TILE + x] >= 0;
+}
+
+/**
+ * @brief [Utility] Adds a hold on a tile, taking it out of the free list in O(1) on the first one
+ */
+static void Chunk_HoldSpawnTile(ChunkSpawnGrid* grid, int x, int y) {
+    if (x < 0 || x >= CHUNK_SIZE_TILE || y < 0 || y >= CHUNK_SIZE_TILE) return;
+    int tile = y * CHUNK_SIZE_TILE + x;
+    if (!grid->interior[tile] || grid->holders[tile]++ > 0) return;
+
+    int index = grid->freeIndex[tile];
+    int last = grid->freeTiles[--grid->freeCount];
+    grid->freeTiles[index] = last;
+    grid->freeIndex[last] = index;
+    grid->freeIndex[tile] = -1;
+}
+
+/**
+ * @brief [Utility] Drops a hold on a tile, putting it back in the free list in O(1) with the last one
+ */
+static void Chunk_UnholdSpawnTile(ChunkSpawnGrid* grid, int x, int y) {
+    if (x < 0 || x >= CHUNK_SIZE_TILE || y < 0 || y >= CHUNK_SIZE_TILE) return;
+    int tile = y * CHUNK_SIZE_TILE + x;
+    if (!grid->interior[tile] || grid->holders[tile] == 0 || --grid->holders[tile] > 0) return;
+
+    grid->freeIndex[tile] = grid->freeCount;
+    grid->freeTiles[grid->freeCount++] = tile;
+}
+
+/**
+ * @brief [Utility] Holds every tile of an area and fills the reservation that gives them back
+ *
+ * The area is clamped to the chunk, tiles outside the room's interior are
+ * skipped by Chunk_HoldSpawnTile().
+ *
+ * @param grid The grid
+ * @param startX Chunk-local first column of the area
+ * @param startY Chunk-local first row of the area
+ * @param endX Chunk-local last column of the area
+ * @param endY Chunk-local last row of the area
+ * @param reservation Receives the reservation
+ */
+static void Chunk_ReserveSpawnArea(ChunkSpawnGrid* grid, int startX, int startY, int endX, int endY, ChunkSpawnReservation* reservation) {
+    startX = MAX(startX, 0);
+    startY = MAX(startY, 0);
+    endX = MIN(endX, CHUNK_SIZE_TILE - 1);
+    endY = MIN(endY, CHUNK_SIZE_TILE - 1);
+    for (int y = startY; y <= endY; y++) {
+        for (int x = startX; x <= endX; x++) {
+            Chunk_HoldSpawnTile(grid, x, y);
+        }
+    }
+    *reservation = (ChunkSpawnReservation) {
+        .gridId = grid->id,
+        .grid = (Uint8) (grid - spawnGrids),
+        .startX = (Uint8) startX,
+        .startY = (Uint8) startY,
+        .endX = (Uint8) endX,
+        .endY = (Uint8) endY
+    };
+}
+
+/**
+ * @brief [Utility] Gets how many tiles a hitbox reaches past its center tile, e.g. 1 for a 38px Juggernaut
+ */
+static int Chunk_GetSpawnRadius(float size) {
+    return MAX(0, (int) SDL_ceilf((size - TILE_SIZE_PIXELS) / 2.0f / TILE_SIZE_PIXELS));
+}
+
+/**
+ * @brief [Utility] Gets the chunk-local tile under a world position
+ */
+static void Chunk_GetLocalTile(const EnvironmentChunk* chunk, Vec2 position, int* x, int* y) {
+    Vec2 origin = Vec2_Multiply(chunk->position, CHUNK_SIZE_PIXEL);
+    *x = (int) SDL_floorf((position.x - origin.x) / TILE_SIZE_PIXELS);
+    *y = (int) SDL_floorf((position.y - origin.y) / TILE_SIZE_PIXELS);
+}
+
+/**
+ * @brief [Utility] Gets the chunk-local tiles covered by a hitbox centered on a world position
+ */
+static void Chunk_GetHitboxTiles(const EnvironmentChunk* chunk, Vec2 position, Vec2 size, int* startX, int* startY, int* endX, int* endY) {
+    Vec2 start = Vec2_Subtract(position, Vec2_Divide(size, 2));
+    Chunk_GetLocalTile(chunk, start, startX, startY);
+    Chunk_GetLocalTile(chunk, Vec2_Add(start, Vec2_Subtract(size, (Vec2) {1, 1})), endX, endY);
+}
+
+/**
+ * @brief [Utility] Gets the grid of a room if it has one
+ */
+static ChunkSpawnGrid* Chunk_FindSpawnGrid(const EnvironmentChunk* chunk) {
+    if (!chunk) return NULL;
+    for (int i = 0; i < CHUNK_SPAWN_GRIDS; i++) {
+        if (spawnGrids[i].chunk == chunk) return &spawnGrids[i];
+    }
+    return NULL;
+}
+
+/**
+ * @brief [Utility] Gets the grid of a room, building it on the room's first spawn
+ *
+ * Uses the same interior bounds as Chunk_GetRandomTileInRoom(), which keep
+ * a one tile gap to the walls, then moves the reservation of every live
+ * enemy already in the room into it. When every grid is in use, the one
+ * built longest ago is replaced.
+ *
+ * @param chunk Pointer to the chunk containing the room
+ * @return ChunkSpawnGrid* The room's grid
+ */
+static ChunkSpawnGrid* Chunk_GetSpawnGrid(EnvironmentChunk* chunk) {
+    ChunkSpawnGrid* grid = Chunk_FindSpawnGrid(chunk);
+    if (grid) return grid;
+
+    grid = &spawnGrids[nextSpawnGridSlot];
+    nextSpawnGridSlot = (nextSpawnGridSlot + 1) % CHUNK_SPAWN_GRIDS;
+    grid->chunk = chunk;
+    grid->id = nextSpawnGridId++;
+    grid->freeCount = 0;
+    for (int i = 0; i < SPAWN_GRID_TILES; i++) {
+        grid->freeIndex[i] = -1;
+        grid->holders[i] = 0;
+        grid->interior[i] = false;
+    }
+
+    int roomStartX = ROOM_STARTX(chunk->roomSize) + 1;
+    int roomStartY = ROOM_STARTY(chunk->roomSize) + 1;
+    int roomEndX = ROOM_ENDX(chunk->roomSize) - 1;
+    int roomEndY = ROOM_ENDY(chunk->roomSize) - 2;
+    for (int y = roomStartY; y <= roomEndY; y++) {
+        for (int x = roomStartX; x <= roomEndX; x++) {
+            int tile = y * CHUNK_SIZE_TILE + x;
+            grid->interior[tile] = true;
+            grid->freeIndex[tile] = grid->freeCount;
+            grid->freeTiles[grid->freeCount++] = tile;
+        }
+    }
+
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        EnemyBucket* bucket = &EnemyBuckets[type];
+        for (int i = 0; i < bucket->count; i++) {
+            EnemyData* enemy = &enemies[bucket->indices[i]];
+            if (enemy->state.isDead) continue;
+            if (Chunk_GetCurrentChunk(enemy->state.position) != chunk) continue;
+            // An enemy that walked in from another room gives that room its tiles back
+            Chunk_ReleaseSpawnTile(&enemy->state.spawnReservation);
+            SDL_Rect hitbox = enemy->state.collider.hitbox;
+            int startX, startY, endX, endY;
+            Chunk_GetHitboxTiles(chunk, enemy->state.position, (Vec2) {hitbox.w, hitbox.h}, &startX, &startY, &endX, &endY);
+            Chunk_ReserveSpawnArea(grid, startX, startY, endX, endY, &enemy->state.spawnReservation);
+        }
+    }
+    return grid;
+}
+
+/**
+ * @brief [Utility] Checks that an area only covers free tiles and stays clear of the player
+ *
+ * The player keeps a tile of breathing room, as they keep moving during
+ * the spawn delay.
+ */
+static bool Chunk_SpawnAreaIsFree(const ChunkSpawnGrid* grid, int x, int y, int radiusX, int radiusY, SDL_Rect playerTiles) {
+    if (x + radiusX >= playerTiles.x && x - radiusX <= playerTiles.x + playerTiles.w &&
+        y + radiusY >= playerTiles.y && y - radiusY <= playerTiles.y + playerTiles.h) {
+        return false;
+    }
+    for (int dy = -radiusY; dy <= radiusY; dy++) {
+        for (int dx = -radiusX; dx <= radiusX; dx++) {
+            if (!Chunk_SpawnTileIsFree(grid, x + dx, y + dy)) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * [Utility] Reserves a free spawn point in a room
+ *
+ * Picks a random free tile whose surroundings can hold the given hitbox,
+ * then holds the covered tiles until the reservation is released, so
+ * later spawns avoid it. Chunk_MoveSpawnReservation() keeps it on the
+ * enemy while it moves. Random picks make this O(1) in practice; a scan
+ * of the free list is only used when the room is nearly full.
+ *
+ * @param chunk Pointer to the chunk containing the room
+ * @param hitboxSize Size in pixels of the hitbox that will be centered on the tile
+ * @param position Receives the tile center in world coordinates
+ * @param reservation Receives the reservation, give it to Chunk_ReleaseSpawnTile() once the enemy is gone
+ * @return bool False if no free area is left for this hitbox
+ */
+bool Chunk_TakeSpawnTile(EnvironmentChunk* chunk, Vec2 hitboxSize, Vec2* position, ChunkSpawnReservation* reservation) {
+    if (!chunk) return false;
+    ChunkSpawnGrid* grid = Chunk_GetSpawnGrid(chunk);
+    if (grid->freeCount == 0) return false;
+
+    int radiusX = Chunk_GetSpawnRadius(hitboxSize.x);
+    int radiusY = Chunk_GetSpawnRadius(hitboxSize.y);
+
+    // Tiles the player covers, grown by one on every side
+    SDL_Rect hitbox = player.state.collider.hitbox;
+    int playerStartX, playerStartY, playerEndX, playerEndY;
+    Chunk_GetLocalTile(chunk, (Vec2) {hitbox.x, hitbox.y}, &playerStartX, &playerStartY);
+    Chunk_GetLocalTile(chunk, (Vec2) {hitbox.x + hitbox.w - 1, hitbox.y + hitbox.h - 1}, &playerEndX, &playerEndY);
+    SDL_Rect playerTiles = {playerStartX - 1, playerStartY - 1, playerEndX - playerStartX + 2, playerEndY - playerStartY + 2};
+
+    int tile = -1;
+    for (int attempt = 0; attempt < SPAWN_GRID_RANDOM_ATTEMPTS && tile < 0; attempt++) {
+        int candidate = grid->freeTiles[Random_Int(RANDOM_STREAM_AI, 0, grid->freeCount - 1)];
+        if (Chunk_SpawnAreaIsFree(grid, candidate % CHUNK_SIZE_TILE, candidate / CHUNK_SIZE_TILE, radiusX, radiusY, playerTiles)) {
+            tile = candidate;
+        }
+    }
+    for (int i = 0; i < grid->freeCount && tile < 0; i++) {
+        int candidate = grid->freeTiles[i];
+        if (Chunk_SpawnAreaIsFree(grid, candidate % CHUNK_SIZE_TILE, candidate / CHUNK_SIZE_TILE, radiusX, radiusY, playerTiles)) {
+            tile = candidate;
+        }
+    }
+    if (tile < 0) return false;
+
+    int x = tile % CHUNK_SIZE_TILE;
+    int y = tile / CHUNK_SIZE_TILE;
+    Chunk_ReserveSpawnArea(grid, x - radiusX, y - radiusY, x + radiusX, y + radiusY, reservation);
+
+    *position = Vec2_Add(
+        Tile_TileIndexToPixel((Vec2) {x, y}, chunk->position),
+        (Vec2) {TILE_SIZE_PIXELS / 2, TILE_SIZE_PIXELS / 2}
+    );
+    return true;
+}
+
+/**
+ * [Utility] Gives back the tiles of a reservation
+ *
+ * Does nothing for an empty reservation or one whose grid was replaced,
+ * and empties the reservation so it is only released once.
+ *
+ * @param reservation The reservation
+ */
+void Chunk_ReleaseSpawnTile(ChunkSpawnReservation* reservation) {
+    ChunkSpawnGrid* grid = Chunk_GetReservationGrid(reservation);
+    if (grid) {
+        for (int y = reservation->startY; y <= reservation->endY; y++) {
+            for (int x = reservation->startX; x <= reservation->endX; x++) {
+                Chunk_UnholdSpawnTile(grid, x, y);
+            }
+        }
+    }
+    *reservation = (ChunkSpawnReservation) {0};
+}
+
+/**
+ * [Utility] Moves a reservation onto the tiles a hitbox covers now
+ *
+ * Only touches the grid when the covered tiles change, so calling it on
+ * every move costs a tile lookup. A hitbox in a room without a grid drops
+ * its reservation; the room's grid picks it up once it is built.
+ *
+ * @param reservation The reservation to move
+ * @param position Center of the hitbox in world coordinates
+ * @param size Size of the hitbox in pixels
+ */
+void Chunk_MoveSpawnReservation(ChunkSpawnReservation* reservation, Vec2 position, Vec2 size) {
+    EnvironmentChunk* chunk = Chunk_GetCurrentChunk(position);
+    ChunkSpawnGrid* grid = Chunk_FindSpawnGrid(chunk);
+    if (!grid) {
+        Chunk_ReleaseSpawnTile(reservation);
+        return;
+    }
+
+    int startX, startY, endX, endY;
+    Chunk_GetHitboxTiles(chunk, position, size, &startX, &startY, &endX, &endY);
+    if (Chunk_GetReservationGrid(reservation) == grid &&
+        reservation->startX == MAX(startX, 0) && reservation->startY == MAX(startY, 0) &&
+        reservation->endX == MIN(endX, CHUNK_SIZE_TILE - 1) && reservation->endY == MIN(endY, CHUNK_SIZE_TILE - 1)) {
+        return;
+    }
+
+    // Hold the new tiles first, so tiles in both areas never pass through the free list
+    ChunkSpawnReservation moved;
+    Chunk_ReserveSpawnArea(grid, startX, startY, endX, endY, &moved);
+    Chunk_ReleaseSpawnTile(reservation);
+    *reservation = moved;
+}
+
+/**
+ * [Utility] Forgets every spawn grid
+ *
+ * Called when the rooms of the map are released, as a new map can reuse
+ * the same chunk storage.
+ */
+void Chunk_ResetSpawnGrids() {
+    for (int i = 0; i < CHUNK_SPAWN_GRIDS; i++) {
+        spawnGrids[i].chunk = NULL;
+        spawnGrids[i].id = 0;
+    }
+}
@@ -19,21 +19,21 @@
  * @return bool True if the chunk is valid, false otherwise
  */
 bool Chunk_IsValid(Vec2 chunkIndex) {
-    return chunkIndex.x >= 0 && chunkIndex.x < MAP_SIZE_CHUNK && chunkIndex.y >= 0 && chunkIndex.y < MAP_SIZE_CHUNK;
+    return chunkIndex.x >= 0 && chunkIndex.x < testMap.width && chunkIndex.y >= 0 && chunkIndex.y < testMap.height;
 }
 
 /**
  * [Utility] Gets the chunk at a specific world position
  * 
  * @param position World position to check
- * @return EnvironmentChunk* Pointer to the chunk at that position
+ * @return EnvironmentChunk* Pointer to the room at that position, NULL if there is none
  */
 EnvironmentChunk* Chunk_GetCurrentChunk(Vec2 position) {
     Vec2 chunkIndex = Vec2_Divide(position, (float) CHUNK_SIZE_PIXEL);
     if (!Chunk_IsValid(chunkIndex)) {
         return NULL;
     }
-    return &testMap.chunks[(int) chunkIndex.x][(int) chunkIndex.y];
+    return Map_GetChunk(&testMap, chunkIndex.x, chunkIndex.y);
 }
 
 Vec2 Chunk_GetChunkCenter(EnvironmentChunk* chunk) {
@@ -56,8 +56,8 @@ Vec2 Chunk_GetRandomTileInRoom(EnvironmentChunk* chunk) {
     float roomEndY = ROOM_ENDY(chunk->roomSize) - 2;
 
     Vec2 tileIndex = (Vec2) {
-        RandInt(roomStartX, roomEndX),
-        RandInt(roomStartY, roomEndY)
+        Random_Int(RANDOM_STREAM_AI, roomStartX, roomEndX),
+        Random_Int(RANDOM_STREAM_AI, roomStartY, roomEndY)
     };
 
     return Tile_TileIndexToPixel(tileIndex, chunk->position);
@@ -114,10 +114,5 @@ Vec2 Chunk_GetRoomBottomRight(EnvironmentChunk* chunk) {
 
 bool Chunk_IsOnMainPath(EnvironmentChunk* chunk) {
     if (!chunk) return false;
-    for (int i = 0; i < testMap.mainPathLength; i++) {
-        if (Vec2_AreEqual(chunk->position, testMap.mainPath[i])) {
-            return true;
-        }
-    }
-    return false;
+    return Map_IsOnMainPath(&testMap, chunk->position);
 }
\ No newline at end of file
@@ -0,0 +1,140 @@
+/**
+ * @file chunk_walls.c
+ * @brief Derives the wall colliders of a chunk from its tiles
+ *
+ * Solid tiles are covered with as few rectangles as a greedy merge finds:
+ * each rectangle grows right along its row, then down while the whole span
+ * stays solid. All of a chunk's wall colliders live in one block it owns.
+ *
+ * @author Mango
+ * @date 2025-04-18
+ */
+
+#include <chunks.h>
+#include <profiler.h>
+#include <string.h>
+
+/**
+ * @brief [Utility] Checks if a tile can be walked on
+ */
+static bool Chunk_IsWalkableTile(EnvironmentTile tile) {
+    TileType type = TILE_GET_TYPE(tile);
+    return (type >= TILE_FLOOR_1 && type <= TILE_FLOOR_SCRATCHED_3) || type == TILE_WALL_BOTTOM;
+}
+
+/**
+ * @brief [Utility] Checks if a tile blocks movement
+ *
+ * Wall tops and borders are solid, while the bottom of a wall is drawn in
+ * front of the floor and can be walked over. Void is only solid where it
+ * borders the floor, which is how the bottom edge of a room is closed.
+ *
+ * @param chunk Pointer to the chunk
+ * @param x Tile column
+ * @param y Tile row
+ * @return bool True if the tile needs a collider
+ */
+static bool Chunk_IsSolidTile(const EnvironmentChunk* chunk, int x, int y) {
+    TileType type = TILE_GET_TYPE(chunk->tiles[x][y]);
+    if (type != TILE_VOID) return !Chunk_IsWalkableTile(chunk->tiles[x][y]);
+
+    if (x > 0 && Chunk_IsWalkableTile(chunk->tiles[x - 1][y])) return true;
+    if (x < CHUNK_SIZE_TILE - 1 && Chunk_IsWalkableTile(chunk->tiles[x + 1][y])) return true;
+    if (y > 0 && Chunk_IsWalkableTile(chunk->tiles[x][y - 1])) return true;
+    if (y < CHUNK_SIZE_TILE - 1 && Chunk_IsWalkableTile(chunk->tiles[x][y + 1])) return true;
+    return false;
+}
+
+/**
+ * [Utility] Builds the wall colliders of a chunk from its solid tiles
+ *
+ * Runs the greedy merge twice, once to count the rectangles and once to
+ * fill the block allocated for them, so the chunk makes a single
+ * allocation whatever its layout. Release the previous walls first with
+ * Chunk_ReleaseColliders().
+ *
+ * @param chunk Pointer to the chunk
+ */
+void Chunk_GenerateWallColliders(EnvironmentChunk* chunk) {
+    bool solid[CHUNK_SIZE_TILE][CHUNK_SIZE_TILE];
+    for (int x = 0; x < CHUNK_SIZE_TILE; x++) {
+        for (int y = 0; y < CHUNK_SIZE_TILE; y++) {
+            solid[x][y] = Chunk_IsSolidTile(chunk, x, y);
+        }
+    }
+
+    bool covered[CHUNK_SIZE_TILE][CHUNK_SIZE_TILE];
+    int count = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            if (count == 0) return;
+            chunk->walls = malloc(count * sizeof(Collider));
+            PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 1);
+            if (!chunk->walls) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate %d wall colliders", count);
+                return;
+            }
+        }
+        memset(covered, 0, sizeof(covered));
+
+        for (int y = 0; y < CHUNK_SIZE_TILE; y++) {
+            for (int x = 0; x < CHUNK_SIZE_TILE; x++) {
+                if (!solid[x][y] || covered[x][y]) continue;
+
+                int width = 1;
+                while (x + width < CHUNK_SIZE_TILE && solid[x + width][y] && !covered[x + width][y]) width++;
+                int height = 1;
+                while (y + height < CHUNK_SIZE_TILE) {
+                    bool rowSolid = true;
+                    for (int i = x; i < x + width && rowSolid; i++) {
+                        rowSolid = solid[i][y + height] && !covered[i][y + height];
+                    }
+                    if (!rowSolid) break;
+                    height++;
+                }
+                for (int i = x; i < x + width; i++) {
+                    for (int j = y; j < y + height; j++) covered[i][j] = true;
+                }
+
+                if (pass == 0) {
+                    count++;
+                    continue;
+                }
+                Collider* collider = &chunk->walls[chunk->wallCount++];
+                *collider = (Collider) {
+                    .hitbox = {
+                        x * TILE_SIZE_PIXELS + chunk->position.x * CHUNK_SIZE_PIXEL,
+                        y * TILE_SIZE_PIXELS + chunk->position.y * CHUNK_SIZE_PIXEL,
+                        width * TILE_SIZE_PIXELS,
+                        height * TILE_SIZE_PIXELS
+                    },
+                    .layer = COLLISION_LAYER_ENVIRONMENT,
+                    .collidesWith = COLLISION_LAYER_NONE
+                };
+                Collider_Register(collider, NULL);
+            }
+        }
+    }
+}
+
+/**
+ * [Utility] Unregisters and frees every collider of a chunk
+ *
+ * @param chunk Pointer to the chunk
+ */
+void Chunk_ReleaseColliders(EnvironmentChunk* chunk) {
+    for (int i = 0; i < chunk->colliderCount; i++) {
+        Collider_Reset(chunk->colliders[i]);
+        free(chunk->colliders[i]);
+    }
+    chunk->colliderCount = 0;
+    for (int i = 0; i < CHUNK_DOOR_COUNT; i++) {
+        chunk->doorColliders[i] = NULL;
+        chunk->hallwayTriggers[i] = NULL;
+    }
+
+    for (int i = 0; i < chunk->wallCount; i++) Collider_Reset(&chunk->walls[i]);
+    free(chunk->walls);
+    chunk->walls = NULL;
+    chunk->wallCount = 0;
+}
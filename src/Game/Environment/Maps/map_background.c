@@ -0,0 +1,97 @@
+/**
+ * @file map_background.c
+ * @brief Generates the next map on a worker thread
+ *
+ * While the level transition plays, the layout of the next stage is rolled
+ * into a second EnvironmentMap by a worker thread. Once the transition is
+ * over, the two maps are swapped and the new one is built on the main
+ * thread, which only has to register colliders and interactables.
+ *
+ * @author Mango
+ * @date 2025-04-18
+ */
+
+#include <maps.h>
+
+/**
+ * @brief Map the worker generates into, holds the storage of the previous map after a swap
+ */
+static EnvironmentMap nextMap = {0};
+
+static SDL_Thread* mapWorker = NULL;
+static bool nextMapPending = false;
+static int nextMapStage = 0;
+static Uint64 nextMapSeed = 0;
+
+/**
+ * @brief [Utility] Worker thread entry, rolls the layout of nextMap
+ *
+ * @param data Unused
+ * @return int Always 0
+ */
+static int Map_BackgroundWorker(void* data) {
+    (void) data;
+    Uint64 start = SDL_GetPerformanceCounter();
+    Map_GenerateLayout(&nextMap, nextMapStage, nextMapSeed);
+    SDL_Log("Stage %d generated in the background in %.2f ms", nextMapStage,
+        (double) (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency());
+    return 0;
+}
+
+/**
+ * [Utility] Starts generating the layout of the next map on a worker thread
+ *
+ * If the thread cannot be created, the layout is generated by
+ * Map_FinishBackgroundGeneration() instead.
+ *
+ * @param stage The stage the map is for
+ * @param seed Seed of the map's generator
+ */
+void Map_GenerateInBackground(int stage, Uint64 seed) {
+    Map_CancelBackgroundGeneration();
+    nextMapStage = stage;
+    nextMapSeed = seed;
+    nextMapPending = true;
+    mapWorker = SDL_CreateThread(Map_BackgroundWorker, "MapWorker", NULL);
+    if (!mapWorker) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to start the map worker, generating on the main thread: %s", SDL_GetError());
+    }
+}
+
+/**
+ * [Utility] Replaces testMap with the map generated in the background
+ *
+ * The maps are swapped by value: they only hold pointers to their storage,
+ * so the rooms do not move and the previous map's storage is reused by the
+ * next background generation.
+ */
+void Map_FinishBackgroundGeneration() {
+    if (!nextMapPending) {
+        Map_Generate();
+        return;
+    }
+    if (mapWorker) {
+        SDL_WaitThread(mapWorker, NULL);
+        mapWorker = NULL;
+    } else {
+        Map_GenerateLayout(&nextMap, nextMapStage, nextMapSeed);
+    }
+    nextMapPending = false;
+
+    Map_ReleaseColliders(&testMap);
+    EnvironmentMap previousMap = testMap;
+    testMap = nextMap;
+    nextMap = previousMap;
+    Map_Build(&testMap);
+}
+
+/**
+ * [Utility] Waits for the background worker and throws away what it generated
+ */
+void Map_CancelBackgroundGeneration() {
+    if (mapWorker) {
+        SDL_WaitThread(mapWorker, NULL);
+        mapWorker = NULL;
+    }
+    nextMapPending = false;
+}
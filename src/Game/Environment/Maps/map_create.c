@@ -14,194 +14,226 @@
 #include <random.h>
 #include <enemy_types.h>
 #include <interactable.h>
-#include <random.h>
 #include <game.h>
+#include <minimap.h>
 
 /**
  * @brief Generates a complete game map
  * 
- * Creates a procedurally generated map with rooms, hallways and paths.
+ * Creates a procedurally generated map with rooms, hallways and paths
+ * for the current stage, and replaces testMap with it right away.
  */
 void Map_Generate() {
-    // 1. Initialize all chunks as empty
-    for (int x = 0; x < MAP_SIZE_CHUNK; x++) {
-        for (int y = 0; y < MAP_SIZE_CHUNK; y++) {
-            testMap.chunks[x][y].totalEnemyCount = 0;
-            testMap.chunks[x][y].empty = true;
-            testMap.chunks[x][y].discovered = false;
-            testMap.chunks[x][y].inCombat = false;
-            testMap.chunks[x][y].roomType = ROOM_TYPE_NORMAL;
-            testMap.chunks[x][y].position = (Vec2){x, y};
-            EnvironmentChunk* chunk = &testMap.chunks[x][y];
-            for (int i = 0; i < chunk->colliderCount; i++) {
-                Collider_Reset(chunk->colliders[i]);
-                free(chunk->colliders[i]);
-            }
-            chunk->colliderCount = 0;
-        }
-    }
-    for (int i = 0; i < testMap.mainPathLength; i++) {
-        testMap.mainPath[i] = Vec2_Zero;
-    }
-    for (int i = 0; i < testMap.alternatePathLength; i++) {
-        testMap.alternatePath[i] = Vec2_Zero;
+    // A map still being generated for a transition is outdated now
+    Map_CancelBackgroundGeneration();
+
+    // 1. Free the colliders of the previous map
+    Map_ReleaseColliders(&testMap);
+    Map_GenerateLayout(&testMap, game.currentStage, Game_GetStageSeed(game.currentStage));
+    Map_Build(&testMap);
+}
+
+/**
+ * @brief Rolls the rooms, paths and tiles of a map
+ * 
+ * Everything random is rolled from the map's own generator, including the
+ * contents of crate rooms, so the same stage and seed always give the same
+ * map and nothing shared is touched. The interactables and colliders are
+ * only created by Map_Build().
+ * 
+ * @param map The map to fill, its previous colliders must already be released
+ * @param stage The stage the map is for, stage 10 being the boss stage
+ * @param seed Seed of the map's generator
+ */
+void Map_GenerateLayout(EnvironmentMap* map, int stage, Uint64 seed) {
+    int size = app.config.mapSize > 0 ? app.config.mapSize : MAP_DEFAULT_SIZE_CHUNK;
+    int length = app.config.mapLength > 0 ? app.config.mapLength : MAP_DEFAULT_LENGTH;
+    if (size < MAP_MIN_SIZE_CHUNK) {
+        SDL_Log("Map size %d is too small, using %d", size, MAP_MIN_SIZE_CHUNK);
+        size = MAP_MIN_SIZE_CHUNK;
     }
-    testMap.mainPathLength = 0;
-    testMap.alternatePathLength = 0;
-    Interactable_Reset();
+    if (Map_Reserve(map, size, length)) return;
+    RandomState_Seed(&map->random, seed, RANDOM_STREAM_MAP);
 
-    int startX = 3; 
-    int startY = 3; 
-    Map_SetStartChunk(startX, startY);
+    // The start room sits in the middle of the grid, (3, 3) on the default map
+    int startX = (map->width - 1) / 2;
+    int startY = (map->height - 1) / 2;
+    Map_SetStartChunk(map, startX, startY);
 
-    if (game.currentStage != 10) {
-        Map_CreateMainPath();
-        Map_SetEndChunk(testMap.mainPath[testMap.mainPathLength].x, testMap.mainPath[testMap.mainPathLength].y);
-        SDL_Log("Current position: (%d, %d) - Target position: (%d, %d)\n", startX, startY,(int) testMap.mainPath[testMap.mainPathLength].x, (int) testMap.mainPath[testMap.mainPathLength].y);
-        for(int k = 0; k < testMap.mainPathLength;k++)
+    if (stage != 10) {
+        Map_CreateMainPath(map);
+        Map_SetEndChunk(map, map->mainPath[map->mainPathLength].x, map->mainPath[map->mainPathLength].y);
+        SDL_Log("Current position: (%d, %d) - Target position: (%d, %d)\n", startX, startY,(int) map->mainPath[map->mainPathLength].x, (int) map->mainPath[map->mainPathLength].y);
+        for(int k = 0; k < map->mainPathLength;k++)
         {
-            SDL_Log("Main Path: (%d, %d)", (int) testMap.mainPath[k].x, (int) testMap.mainPath[k].y);
+            SDL_Log("Main Path: (%d, %d)", (int) map->mainPath[k].x, (int) map->mainPath[k].y);
         }
         SDL_Log("Main path generation complete");
 
         SDL_Log("Checking for alternate paths/branches...\n");
-        for (int x = 0; x < MAP_SIZE_CHUNK; x++) {
-            for (int y = 0; y < MAP_SIZE_CHUNK; y++) {
-                if (testMap.chunks[x][y].empty) {
-                    continue;
-                }
-
-                if (Vec2_AreEqual((Vec2) {x, y}, testMap.startChunk->position) || Vec2_AreEqual((Vec2) {x, y}, testMap.endChunk->position)) {
-                    continue;
-                }
-                if (!Chunk_IsOnMainPath(&testMap.chunks[x][y])) {
-                    SDL_Log("Alternate path at (%d, %d)", x, y);
-                    testMap.alternatePath[testMap.alternatePathLength++] = (Vec2){x, y};
-                }
+        for (int i = 0; i < map->chunkCount; i++) {
+            EnvironmentChunk* chunk = &map->chunks[i];
+            if (chunk == map->startChunk || chunk == map->endChunk) {
+                continue;
+            }
+            if (!Map_IsOnMainPath(map, chunk->position)) {
+                SDL_Log("Alternate path at (%d, %d)", (int) chunk->position.x, (int) chunk->position.y);
+                map->alternatePath[map->alternatePathLength++] = chunk->position;
             }
         }
         int maxChestRoom = 2;
         for (int i = 0; i < maxChestRoom; i++) {
-            if (testMap.alternatePathLength == 0) {
+            if (map->alternatePathLength == 0) {
                 break;
             }
-            int randomIndex = RandInt(0, testMap.alternatePathLength - 1);
-            Vec2 chunkPosition = testMap.alternatePath[randomIndex];
-            testMap.chunks[(int) chunkPosition.x][(int) chunkPosition.y].roomType = ROOM_TYPE_CRATE;
+            int randomIndex = RandomState_Int(&map->random, 0, map->alternatePathLength - 1);
+            Vec2 chunkPosition = map->alternatePath[randomIndex];
+            Map_GetChunk(map, chunkPosition.x, chunkPosition.y)->roomType = ROOM_TYPE_CRATE;
             SDL_Log("Crate room generated at alternate path (%d, %d)", (int) chunkPosition.x, (int) chunkPosition.y);
         }
     } else {
-        testMap.chunks[3][2].empty = false;
-        testMap.chunks[3][2].roomType = ROOM_TYPE_BOSS;
-        testMap.chunks[3][2].roomSize = (Vec2) {30, 16};
-        testMap.chunks[3][2].totalEnemyCount = 1;
-        Map_SetEndChunk(3, 1);
+        EnvironmentChunk* bossChunk = Map_AddChunk(map, startX, startY - 1);
+        bossChunk->roomType = ROOM_TYPE_BOSS;
+        bossChunk->roomSize = (Vec2) {30, 16};
+        bossChunk->totalEnemyCount = 1;
+        Map_SetEndChunk(map, startX, startY - 2);
     }
-    
-    
-    
 
+    // 2. Lay out all rooms
+    for (int i = 0; i < map->chunkCount; i++) {
+        EnvironmentChunk* chunk = &map->chunks[i];
+        SDL_Log ("Generating chunk at (%d, %d)\n", (int) chunk->position.x, (int) chunk->position.y);
+        // Set hallways based on adjacent rooms
+        chunk->floorPattern = ROOM_FLOOR_PATTERN_1;
+        // Rolled for every room so the floor follows the run seed whatever the pattern
+        chunk->floorSeed = RandomState_Next(&map->random);
+        chunk->hallways = Map_GetChunkHallways(chunk, map);
 
-    
-    // 5. Initialize all non-empty chunks
-    for (int x = 0; x < MAP_SIZE_CHUNK; x++) {
-        for (int y = 0; y < MAP_SIZE_CHUNK; y++) {
-            if (testMap.chunks[x][y].empty) {
-                continue;
-            }
-            SDL_Log ("Generating chunk at (%d, %d)\n", x, y);
-            // Set hallways based on adjacent non-empty chunks
-            testMap.chunks[x][y].floorPattern = ROOM_FLOOR_PATTERN_1;
-            testMap.chunks[x][y].position = (Vec2){x, y};
-            testMap.chunks[x][y].hallways = Map_GetChunkHallways(testMap.chunks[x][y], testMap);
+        // Generate room details
+        if ((chunk->roomType == ROOM_TYPE_NORMAL)) {
+            int totalEnemyCount = 10 + stage;
+            chunk->totalEnemyCount = RandomState_Int(&map->random, totalEnemyCount / 2, totalEnemyCount * 3 / 2);
+            chunk->roomSize = (Vec2){RandomState_Int(&map->random, 10,15)*2, RandomState_Int(&map->random, 10,15)*2};
+        }
+        if (chunk->roomType == ROOM_TYPE_CRATE) {
+            chunk->roomSize = (Vec2){12, 12}; // Slightly larger start room
+            chunk->crateGun = RandomState_Int(&map->random, 0, GUN_COUNT - 1);
+            chunk->crateLog = RandomState_Int(&map->random, 0,10) <= 6 ? RandomState_Int(&map->random, 1, 22) : 0;
+        }
+        Chunk_GenerateFloorTiles(chunk);
+        Chunk_GenerateWallTiles(chunk);
+        Chunk_GenerateHallways(chunk);
+        Chunk_GenerateHallwayWallTiles(chunk);
+    }
+}
 
-            // Generate room details
-            if ((testMap.chunks[x][y].roomType == ROOM_TYPE_NORMAL)) {
-                int totalEnemyCount = 10 + game.currentStage;
-                testMap.chunks[x][y].totalEnemyCount = RandInt(totalEnemyCount / 2, totalEnemyCount * 3 / 2);
-                testMap.chunks[x][y].roomSize = (Vec2){RandInt(10,15)*2, RandInt(10,15)*2};
-            }
-            if (testMap.chunks[x][y].roomType == ROOM_TYPE_CRATE) {
-                testMap.chunks[x][y].roomSize = (Vec2){12, 12}; // Slightly larger start room
-                Interactable_CreateWeaponCrate(
-                    false, 
-                    RandInt(0, GUN_COUNT - 1), 
+/**
+ * @brief Registers the colliders and interactables of a laid out map
+ * 
+ * The collider registry and the interactables are shared with the rest of
+ * the game, so this runs on the main thread once the layout is done.
+ * 
+ * @param map The map to build
+ */
+void Map_Build(EnvironmentMap* map) {
+    // The minimap is redrawn from the new map on its next render
+    Minimap_Invalidate();
+    Interactable_Reset();
+
+    for (int i = 0; i < map->chunkCount; i++) {
+        EnvironmentChunk* chunk = &map->chunks[i];
+        if (chunk->roomType == ROOM_TYPE_CRATE) {
+            Interactable_CreateWeaponCrate(
+                false, 
+                chunk->crateGun, 
+                Vec2_Add(
+                    Chunk_GetChunkCenter(chunk),
+                    (Vec2){0, TILE_SIZE_PIXELS / 2}
+                )
+            );
+            if (chunk->crateLog > 0) {
+                Interactable_CreateLog(
+                    chunk->crateLog, 
                     Vec2_Add(
-                        Chunk_GetChunkCenter(&testMap.chunks[x][y]),
-                        (Vec2){0, TILE_SIZE_PIXELS / 2}
+                        Chunk_GetChunkCenter(chunk),
+                        (Vec2){0, - 3 * TILE_SIZE_PIXELS / 2}
                     )
                 );
-                if (RandInt(0,10) <= 6) {
-                    Interactable_CreateLog(
-                        RandInt(1, 22), 
-                        Vec2_Add(
-                            Chunk_GetChunkCenter(&testMap.chunks[x][y]),
-                            (Vec2){0, - 3 * TILE_SIZE_PIXELS / 2}
-                        )
-                    );
-                }
             }
-            // Create the chunk with all its details
-            Chunk_GenerateTilesButVoid(&testMap.chunks[x][y]);
         }
+        Chunk_GenerateColliders(chunk);
+    }
+}
+
+/**
+ * @brief Frees the colliders of every room of a map
+ * 
+ * @param map The map whose colliders to free
+ */
+void Map_ReleaseColliders(EnvironmentMap* map) {
+    for (int i = 0; i < map->chunkCount; i++) {
+        Chunk_ReleaseColliders(&map->chunks[i]);
     }
+    Chunk_ResetSpawnGrids();
 }
 
 /**
  * @brief Sets the starting chunk of the map
  * 
+ * @param map The map being generated
  * @param x X-coordinate of the start chunk
  * @param y Y-coordinate of the start chunk
  */
-void Map_SetStartChunk(int x, int y) {
-    testMap.startChunk = &testMap.chunks[x][y];
-    testMap.startChunk->empty = false;
-    testMap.startChunk->roomSize = (Vec2){12, 12}; // Slightly larger start room
-    testMap.startChunk->roomType = ROOM_TYPE_START;
-    testMap.startChunk->position = (Vec2){x, y};
+void Map_SetStartChunk(EnvironmentMap* map, int x, int y) {
+    map->startChunk = Map_AddChunk(map, x, y);
+    if (!map->startChunk) return;
+    map->startChunk->roomSize = (Vec2){12, 12}; // Slightly larger start room
+    map->startChunk->roomType = ROOM_TYPE_START;
 }
 
 /**
  * @brief Sets the ending chunk of the map
  * 
+ * @param map The map being generated
  * @param x X-coordinate of the end chunk
  * @param y Y-coordinate of the end chunk
  */
-void Map_SetEndChunk(int x, int y) {
-    testMap.endChunk = &testMap.chunks[x][y];
-    testMap.endChunk->empty = false;
-    testMap.endChunk->roomSize = (Vec2){12, 12}; // Slightly larger end room
-    testMap.endChunk->roomType = ROOM_TYPE_END;
-    testMap.endChunk->position = (Vec2){x, y};
+void Map_SetEndChunk(EnvironmentMap* map, int x, int y) {
+    map->endChunk = Map_AddChunk(map, x, y);
+    if (!map->endChunk) return;
+    map->endChunk->roomSize = (Vec2){12, 12}; // Slightly larger end room
+    map->endChunk->roomType = ROOM_TYPE_END;
 }
 
 /**
  * @brief Creates the main path through the map
  * 
  * Generates a random path from the start to end chunk
+ * 
+ * @param map The map being generated
  */
-void Map_CreateMainPath() {
-    if (testMap.startChunk == NULL) {
+void Map_CreateMainPath(EnvironmentMap* map) {
+    if (map->startChunk == NULL) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Cannot create main path without start and end chunks");
         return; // Cannot create main path without start and end chunks
     }
-    int currentX = testMap.startChunk->position.x;
-    int currentY = testMap.startChunk->position.y;
+    int currentX = map->startChunk->position.x;
+    int currentY = map->startChunk->position.y;
 
     // Reset path tracking
-    testMap.mainPathLength = 0;
-    testMap.mainPath[testMap.mainPathLength] = (Vec2){3, 3}; //So basically, this just allows the main path to start somewhere
+    map->mainPathLength = 0;
+    map->mainPath[map->mainPathLength] = map->startChunk->position; //So basically, this just allows the main path to start somewhere
     SDL_Log("Generating main path");
     
 
 
     int totalAlternateBranch = 0; //Not implemented yet, basically this is gonna be like a stopper for the path
-    for(int i = 0; i < MAP_LENGTH; i++) { //This loops controls how many nodes, like how long is the path gonna be
-        testMap.mainPathLength++;
+    for(int i = 0; i < map->length; i++) { //This loops controls how many nodes, like how long is the path gonna be
+        map->mainPathLength++;
 
         int totalBranch;
         //This is branch randomizer, this is to determine how many branches are gonna be created
-        int totalBranchRandomizer = RandInt(1,10); 
+        int totalBranchRandomizer = RandomState_Int(&map->random, 1,10); 
         if (totalBranchRandomizer <= 6)         totalBranch = 1;    // 60% chance of 1 branch
         else if (totalBranchRandomizer <= 8)    totalBranch = 2;    // 20% chance of 2 branches
         else if (totalBranchRandomizer <= 9)    totalBranch = 3;    // 10% chance of 3 branches
@@ -217,11 +249,11 @@ void Map_CreateMainPath() {
         };
 
         for (int j = 0; j < 4; j++) {
-            if (currentX + placementList[j].x < 0 || currentX + placementList[j].x >= MAP_SIZE_CHUNK) {
+            if (currentX + placementList[j].x < 0 || currentX + placementList[j].x >= map->width) {
                 placementList[j] = Vec2_Zero;
                 continue;
             }
-            if (currentY + placementList[j].y < 0 || currentY + placementList[j].y >= MAP_SIZE_CHUNK) {
+            if (currentY + placementList[j].y < 0 || currentY + placementList[j].y >= map->height) {
                 placementList[j] = Vec2_Zero;
                 continue;
             }
@@ -229,35 +261,20 @@ void Map_CreateMainPath() {
                 currentX + placementList[j].x,
                 currentY + placementList[j].y
             };
-            if(Vec2_AreEqual(nextPosition, (Vec2) {3,3})) {
+            Vec2 fromStart = Vec2_Subtract(nextPosition, map->startChunk->position);
+            bool nearStart = fromStart.x >= -1 && fromStart.x <= 1 && fromStart.y >= -1 && fromStart.y <= 1;
+            if(Vec2_AreEqual(nextPosition, map->startChunk->position)) {
                 SDL_Log("Tile is near spawn, skipping");
                 placementList[j] = Vec2_Zero;
                 continue;
             }
-            if (testMap.mainPathLength > 1) {
-                Vec2 nextPosition = (Vec2) {
-                    currentX + placementList[j].x,
-                    currentY + placementList[j].y
-                };
-                if (Vec2_AreEqual(nextPosition, (Vec2) {2, 3}) || 
-                    Vec2_AreEqual(nextPosition, (Vec2) {4, 3}) || 
-                    Vec2_AreEqual(nextPosition, (Vec2) {3, 2}) || 
-                    Vec2_AreEqual(nextPosition, (Vec2) {3, 4}) ||
-                    Vec2_AreEqual(nextPosition, (Vec2) {2, 2}) ||
-                    Vec2_AreEqual(nextPosition, (Vec2) {2, 4}) ||
-                    Vec2_AreEqual(nextPosition, (Vec2) {4, 4}) ||
-                    Vec2_AreEqual(nextPosition, (Vec2) {4, 2})) {
-                        SDL_Log("Tile is near spawn, skipping");
-                        placementList[j] = Vec2_Zero;
-                        continue;
-                }
+            // After the first step, the path may not come back next to the start room
+            if (map->mainPathLength > 1 && nearStart) {
+                SDL_Log("Tile is near spawn, skipping");
+                placementList[j] = Vec2_Zero;
+                continue;
             }
-            if (
-                testMap.chunks
-                [(int) (currentX + placementList[j].x)]
-                [(int) (currentY + placementList[j].y)]
-                .empty == false
-            ) {
+            if (Map_GetChunk(map, nextPosition.x, nextPosition.y)) {
                 placementList[j] = Vec2_Zero;
                 continue;
             }
@@ -281,13 +298,13 @@ void Map_CreateMainPath() {
             }
             if (allZero) {
                 SDL_Log("No valid branches found, stopping path generation");
-                testMap.mainPathLength--;
+                map->mainPathLength--;
                 break;
             }
 
             // This loop is to ensure a path isn't created twice.
             while (placement.x == 0 && placement.y == 0) {
-                placementIndex = RandInt(0,3); //This randomize which path to take
+                placementIndex = RandomState_Int(&map->random, 0,3); //This randomize which path to take
                 placement = placementList[placementIndex];
                 // Will keep looping until we find a Vec2 that isn't (0,0)
             }
@@ -300,10 +317,10 @@ void Map_CreateMainPath() {
                 case 2: SDL_Log("Branching down"); break;
                 case 3: SDL_Log("Branching left"); break;
             }
-            currentX = testMap.mainPath[testMap.mainPathLength-1].x + placement.x; 
-            currentY = testMap.mainPath[testMap.mainPathLength-1].y + placement.y;
-            testMap.chunks[currentX][currentY].empty = false;
-            testMap.mainPath[testMap.mainPathLength] = (Vec2){currentX, currentY};
+            currentX = map->mainPath[map->mainPathLength-1].x + placement.x; 
+            currentY = map->mainPath[map->mainPathLength-1].y + placement.y;
+            Map_AddChunk(map, currentX, currentY);
+            map->mainPath[map->mainPathLength] = (Vec2){currentX, currentY};
         }
     }
 }
@@ -311,31 +328,33 @@ void Map_CreateMainPath() {
 /**
  * @brief Determines which hallways a chunk should have
  * 
- * @param chunk The chunk to analyze
- * @param map The complete map
+ * @param chunk Pointer to the chunk to analyze
+ * @param map Pointer to the complete map
  * @return RoomHallways Bitmask of hallway directions to create
  */
-RoomHallways Map_GetChunkHallways(EnvironmentChunk chunk, EnvironmentMap map) {
+RoomHallways Map_GetChunkHallways(const EnvironmentChunk* chunk, const EnvironmentMap* map) {
     RoomHallways hallways = HALLWAY_NONE;
-    if (chunk.position.x > 0) {
-        if (!map.chunks[(int) chunk.position.x - 1][(int) chunk.position.y].empty) {
-            hallways |= HALLWAY_LEFT;
-        }
-    }
-    if (chunk.position.x < MAP_SIZE_CHUNK - 1) {
-        if (!map.chunks[(int) chunk.position.x + 1][(int) chunk.position.y].empty) {
-            hallways |= HALLWAY_RIGHT;
-        }
-    }
-    if (chunk.position.y > 0) {
-        if (!map.chunks[(int) chunk.position.x][(int) chunk.position.y - 1].empty) {
-            hallways |= HALLWAY_UP;
-        }
-    }
-    if (chunk.position.y < MAP_SIZE_CHUNK - 1) {
-        if (!map.chunks[(int) chunk.position.x][(int) chunk.position.y + 1].empty) {
-            hallways |= HALLWAY_DOWN;
+    int x = (int) chunk->position.x;
+    int y = (int) chunk->position.y;
+    if (Map_GetChunk(map, x - 1, y)) hallways |= HALLWAY_LEFT;
+    if (Map_GetChunk(map, x + 1, y)) hallways |= HALLWAY_RIGHT;
+    if (Map_GetChunk(map, x, y - 1)) hallways |= HALLWAY_UP;
+    if (Map_GetChunk(map, x, y + 1)) hallways |= HALLWAY_DOWN;
+    return hallways;
+}
+
+/**
+ * @brief Checks if a position is on the main path of a map
+ * 
+ * @param map The map to check
+ * @param position Grid position of the chunk
+ * @return bool True if the position is on the main path
+ */
+bool Map_IsOnMainPath(const EnvironmentMap* map, Vec2 position) {
+    for (int i = 0; i < map->mainPathLength; i++) {
+        if (Vec2_AreEqual(position, map->mainPath[i])) {
+            return true;
         }
     }
-    return hallways;
-}
\ No newline at end of file
+    return false;
+}
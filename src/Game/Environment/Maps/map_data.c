@@ -12,5 +12,6 @@
 #include <maps.h>
 
 EnvironmentMap testMap = {
-    .chunks = {}
+    .grid = NULL,
+    .chunks = NULL
 };
\ No newline at end of file
@@ -19,16 +19,17 @@ void Map_Render() {
     // 2. Determine which chunks are within view
     int startX = MAX(0, viewRect.x / CHUNK_SIZE_PIXEL);
     int startY = MAX(0, viewRect.y / CHUNK_SIZE_PIXEL);
-    int endX = MIN(MAP_SIZE_CHUNK - 1, (viewRect.x + viewRect.w) / CHUNK_SIZE_PIXEL + 1);
-    int endY = MIN(MAP_SIZE_CHUNK - 1, (viewRect.y + viewRect.h) / CHUNK_SIZE_PIXEL + 1);
+    int endX = MIN(testMap.width - 1, (viewRect.x + viewRect.w) / CHUNK_SIZE_PIXEL + 1);
+    int endY = MIN(testMap.height - 1, (viewRect.y + viewRect.h) / CHUNK_SIZE_PIXEL + 1);
     
-    // 3. Only render chunks that are visible
+    // 3. Only render rooms that are visible
     for (int x = startX; x <= endX; x++) {
         for (int y = startY; y <= endY; y++) {
-            // Skip empty chunks
-            if (testMap.chunks[x][y].empty) continue;
+            // Skip positions without a room
+            EnvironmentChunk* chunk = Map_GetChunk(&testMap, x, y);
+            if (!chunk) continue;
             
-            Chunk_Render(&testMap.chunks[x][y]);
+            Chunk_Render(chunk);
         }
     }
     
@@ -0,0 +1,105 @@
+/**
+ * @file map_utils.c
+ * @brief Storage of the map grid and its rooms
+ *
+ * Rooms live in a pool allocated for the path length rather than the grid
+ * size, and the grid only holds pointers into it, so a bigger grid costs a
+ * pointer per empty position instead of a whole chunk.
+ *
+ * @author Mango
+ * @date 2025-04-18
+ */
+
+#include <maps.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * [Utility] Allocates the grid and chunk pool of a map, and empties it
+ *
+ * The pool holds the start room plus MAP_MAX_BRANCHES rooms per main path
+ * step, which is the most Map_CreateMainPath() can place.
+ *
+ * @param map The map to prepare
+ * @param size Chunks per side of the grid
+ * @param length Steps of the main path, used to size the pool
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int Map_Reserve(EnvironmentMap* map, int size, int length) {
+    if (!map->grid || map->width != size || map->height != size || map->length != length) {
+        free(map->grid);
+        free(map->chunks);
+        free(map->mainPath);
+        free(map->alternatePath);
+
+        int capacity = MAX(3, 1 + MAP_MAX_BRANCHES * length);
+        map->grid = calloc((size_t) size * size, sizeof(EnvironmentChunk*));
+        map->chunks = malloc(capacity * sizeof(EnvironmentChunk));
+        map->mainPath = malloc((length + 1) * sizeof(Vec2));
+        map->alternatePath = malloc(capacity * sizeof(Vec2));
+        if (!map->grid || !map->chunks || !map->mainPath || !map->alternatePath) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate a %dx%d map", size, size);
+            free(map->grid);
+            free(map->chunks);
+            free(map->mainPath);
+            free(map->alternatePath);
+            *map = (EnvironmentMap) {0};
+            return 1;
+        }
+        map->width = size;
+        map->height = size;
+        map->length = length;
+        map->chunkCapacity = capacity;
+        SDL_Log("Map storage: %dx%d grid, %d rooms (%d bytes)", size, size, capacity,
+            (int) (size * size * sizeof(EnvironmentChunk*) + capacity * sizeof(EnvironmentChunk)));
+    } else {
+        memset(map->grid, 0, (size_t) size * size * sizeof(EnvironmentChunk*));
+    }
+
+    map->chunkCount = 0;
+    map->startChunk = NULL;
+    map->endChunk = NULL;
+    map->mainPathLength = 0;
+    map->alternatePathLength = 0;
+    return 0;
+}
+
+/**
+ * [Utility] Gets the room at a grid position
+ *
+ * @param map The map to look in
+ * @param x The x coordinate of the chunk
+ * @param y The y coordinate of the chunk
+ * @return EnvironmentChunk* The room, or NULL if there is none or the position is outside the grid
+ */
+EnvironmentChunk* Map_GetChunk(const EnvironmentMap* map, int x, int y) {
+    if (!map->grid || x < 0 || x >= map->width || y < 0 || y >= map->height) return NULL;
+    return map->grid[y * map->width + x];
+}
+
+/**
+ * [Utility] Gets the room at a grid position, taking one from the pool if there is none yet
+ *
+ * New rooms are zeroed normal rooms with no colliders.
+ *
+ * @param map The map to add to
+ * @param x The x coordinate of the chunk
+ * @param y The y coordinate of the chunk
+ * @return EnvironmentChunk* The room, or NULL if the position is outside the grid or the pool is full
+ */
+EnvironmentChunk* Map_AddChunk(EnvironmentMap* map, int x, int y) {
+    if (!map->grid || x < 0 || x >= map->width || y < 0 || y >= map->height) return NULL;
+    EnvironmentChunk** cell = &map->grid[y * map->width + x];
+    if (*cell) return *cell;
+    if (map->chunkCount >= map->chunkCapacity) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Map chunk pool full (%d rooms), skipping (%d, %d)", map->chunkCapacity, x, y);
+        return NULL;
+    }
+
+    EnvironmentChunk* chunk = &map->chunks[map->chunkCount++];
+    memset(chunk, 0, sizeof(EnvironmentChunk));
+    chunk->roomType = ROOM_TYPE_NORMAL;
+    chunk->position = (Vec2) {x, y};
+    *cell = chunk;
+    return chunk;
+}
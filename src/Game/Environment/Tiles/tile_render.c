@@ -14,7 +14,8 @@
 #include <app.h>
 
 void Tile_Render(EnvironmentTile tile, Vec2 tilePosition) {
-    if (!tile.texture) return;
+    SDL_Texture* texture = tiles.resources.textures[TILE_GET_TYPE(tile)];
+    if (!texture) return;
     Vec2 tileWorldPos = Vec2_Multiply(tilePosition, TILE_SIZE_PIXELS);
     Vec2 tileSize = (Vec2) {TILE_SIZE_PIXELS, TILE_SIZE_PIXELS}; 
 
@@ -27,7 +28,7 @@ void Tile_Render(EnvironmentTile tile, Vec2 tilePosition) {
     SDL_Rect screenDest = Vec2_ToRect(tileScreenPos, tileSize);
 
     float angle;
-    switch (tile.rotation) {
+    switch (TILE_GET_ROTATION(tile)) {
         case TILE_ROTATE_CLOCKWISE:         angle = 90;     break;
         case TILE_ROTATE_COUNTERCLOCKWISE:  angle = -90;    break;
         case TILE_ROTATE_180:               angle = 180;    break;
@@ -36,7 +37,7 @@ void Tile_Render(EnvironmentTile tile, Vec2 tilePosition) {
 
     SDL_RenderCopyEx(
         app.resources.renderer, 
-        tile.texture, 
+        texture, 
         NULL, 
         &screenDest, 
         angle, 
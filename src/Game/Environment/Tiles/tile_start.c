@@ -12,40 +12,47 @@
 #include <tiles.h>
 #include <camera.h>
 #include <app.h>
+#include <assets.h>
+#include <asset_loader.h>
+#include <profiler.h>
+
+/**
+ * @brief [Start] Queues every tile texture for the startup asset loader
+ */
+void Tile_QueueAssets() {
+    for (int i = 1; i < TILE_TYPE_COUNT; i++) {
+        AssetLoader_QueueImage(tiles.config.texturePaths[i]);
+    }
+}
 
 /**
  * @brief [Start] Initializes the tile system by loading textures
  * 
- * Loads all tile textures from disk and creates texture resources
- * for each tile type.
+ * Loads all tile textures, usually decoded by the startup loader already,
+ * and creates texture resources for each tile type.
  */
 void Tile_Start() {
     // Load textures
     for (int i = 1; i < TILE_TYPE_COUNT; i++) {
-        SDL_Surface* surface = IMG_Load(tiles.config.texturePaths[i]);
-        if (!surface) {
-            SDL_Log("Failed to load image: %s", IMG_GetError());
-        }
+        SDL_Surface* surface = Assets_LoadSurface(tiles.config.texturePaths[i]);
+        if (!surface) continue;
 
         tiles.resources.textures[i] = SDL_CreateTextureFromSurface(app.resources.renderer, surface);
         SDL_FreeSurface(surface);
+        if (tiles.resources.textures[i]) PROFILER_COUNT(PROFILER_COUNTER_TEXTURES_CREATED, 1);
     }
 }
 
 /**
  * @brief [Utility] Creates a tile of the specified type and rotation
  * 
- * Factory function that constructs a tile with the appropriate
- * texture and rotation.
+ * Packs the type and rotation into a single byte, see EnvironmentTile.
  * 
  * @param type The type of tile to create
  * @param rotation The rotation to apply to the tile
  * @return EnvironmentTile The constructed tile
  */
 EnvironmentTile Tile_Create(TileType type, TileRotation rotation) {
-    return (EnvironmentTile) {
-        .texture = tiles.resources.textures[type],
-        .rotation = rotation
-    };
+    return (EnvironmentTile) (type | (rotation << TILE_TYPE_BITS));
 }
 
@@ -13,6 +13,16 @@
 
 #include <gun.h>
 #include <bullet.h>
+#include <asset_loader.h>
+
+/**
+ * @brief [Start] Queues the spritesheet of every gun for the startup asset loader
+ */
+void Gun_QueueAssets() {
+    for (int i = 0; i < GUN_COUNT; i++) {
+        AssetLoader_QueueImage(GunList[i].animData.spritesheetPath);
+    }
+}
 
 /**
  * @brief [Start] Initializes all guns and their particle emitters
@@ -14,7 +14,14 @@ int Interactable_Create(InteractableType type, Vec2 position) {
                 (SDL_Color){255, 255, 255, 255}, 
                 app.resources.textFont
             );
-            interactables[i].spriteTexture = interactabletextures[type];
+            interactables[i].spriteTexture = interactableSprites[type].texture;
+            if (interactables[i].srcRect.x >= 0) {
+                // Source rects in the data are relative to the sprite's own image
+                interactables[i].srcRect.x += interactableSprites[type].rect.x;
+                interactables[i].srcRect.y += interactableSprites[type].rect.y;
+            } else {
+                interactables[i].srcRect = interactableSprites[type].rect;
+            }
             return i;
         }
     }
@@ -2,8 +2,10 @@
 #include <camera.h>
 #include <stdio.h>
 #include <app.h>
+#include <sprite_batch.h>
 
 void Interactable_Render() {
+    SpriteBatch_Begin();
     for (int i = 0; i < MAX_INTERACTABLES; i++) {
         if (interactables[i].active) {
             SDL_Rect dest =  Vec2_ToCenteredRect(
@@ -21,9 +23,10 @@ void Interactable_Render() {
                 );
             }
             SDL_Rect* srcRect = (interactables[i].srcRect.x >= 0) ? &interactables[i].srcRect : NULL;
-            SDL_RenderCopy(app.resources.renderer, interactables[i].spriteTexture, srcRect, &dest);
+            SpriteBatch_Draw(interactables[i].spriteTexture, srcRect, &dest, 0, NULL, SDL_FLIP_NONE, 255);
         }
     }
+    SpriteBatch_End();
 }
 
 void Interactable_RenderEndRoom() {
@@ -34,7 +37,7 @@ void Interactable_RenderEndRoom() {
                 (Vec2) {120, 80}
             );
             dest.h = 50;
-            SDL_Rect src = {0, 0, 120, 50};
+            SDL_Rect src = {interactables[i].srcRect.x, interactables[i].srcRect.y, 120, 50};
             SDL_RenderCopy(app.resources.renderer, interactables[i].spriteTexture, &src, &dest);
             break;
         }
@@ -1,11 +1,22 @@
 #include <interactable.h>
 #include <app.h>
+#include <asset_loader.h>
 
 Interactable interactables[MAX_INTERACTABLES];
-SDL_Texture* interactabletextures[INTERACTABLE_COUNT];
+SpriteRegion interactableSprites[INTERACTABLE_COUNT];
 UIElement* interactionText;
 flag hasInteraction;
 
+// Queues the interactable sprites and ability icons for the startup asset loader
+void Interactable_QueueAssets() {
+    for (int i = 0; i < INTERACTABLE_COUNT; i++) {
+        if (interactableData[i].spritePath) AssetLoader_QueueImage(interactableData[i].spritePath);
+    }
+    for (int i = 0; i < TOTAL_SKILLS; i++) {
+        AssetLoader_QueueImage(abilityData[i].path);
+    }
+}
+
 void Interactable_Start() {
     for (int i = 0; i < MAX_INTERACTABLES; i++) {
         interactables[i].active = false;
@@ -22,7 +33,10 @@ void Interactable_Start() {
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Interactable %d has no sprite path", i);
             continue;
         }
-        interactabletextures[i] = IMG_LoadTexture(app.resources.renderer, interactableData[i].spritePath);
+        // Packed into the sprite atlas so interactables are drawn in one batch
+        if (SpriteAtlas_Load(interactableData[i].spritePath, &interactableSprites[i])) {
+            interactableSprites[i] = (SpriteRegion) {NULL, {-1, -1, -1, -1}};
+        }
     }
 
     interactionText = UI_CreateText(
@@ -5,15 +5,18 @@
 void Interactable_CreateAbilties(Vec2 position) {
     int index = Interactable_Create(INTERACTABLE_ABILITIES, position);
     
-    int random = RandInt(0, TOTAL_SKILLS - 1);
+    int random = Random_Int(RANDOM_STREAM_LOOT, 0, TOTAL_SKILLS - 1);
     interactables[index].textTexture = UI_CreateTextTexture(
         abilityData[random].name, 
         (SDL_Color){255, 255, 255, 255}, 
         app.resources.textFont
     );
 
-    SDL_Texture * abilityTexture = IMG_LoadTexture(app.resources.renderer, abilityData[random].path);
-    interactables[index].spriteTexture = abilityTexture;
+    SpriteRegion abilitySprite;
+    if (SpriteAtlas_Load(abilityData[random].path, &abilitySprite) == 0) {
+        interactables[index].spriteTexture = abilitySprite.texture;
+        interactables[index].srcRect = abilitySprite.rect;
+    }
 
     int* abilitesType = malloc(sizeof(int));
     *abilitesType = abilityData[random].type;
@@ -11,9 +11,10 @@ void Interactable_CreateWeapon(Gun gun, Vec2 position) {
         (SDL_Color){255, 255, 255, 255}, 
         app.resources.textFont
     );
-    interactables[index].spriteTexture = GunList[gun].resources.animation->spritesheet;
+    Animation* animation = GunList[gun].resources.animation;
+    interactables[index].spriteTexture = animation->spritesheet;
     interactables[index].srcRect = Vec2_ToRect(
-        Vec2_Zero,
+        (Vec2) {animation->sheetRect.x, animation->sheetRect.y},
         GunList[gun].animData.frameSize
     );
     interactables[index].renderSize = GunList[gun].animData.spriteSize;
@@ -5,7 +5,7 @@
 
 void Interactable_CreateHealth(Vec2 position) {
 
-    int random = RandInt(INTERACTABLE_HEALTH, INTERACTABLE_HEALTH_LARGE);
+    int random = Random_Int(RANDOM_STREAM_LOOT, INTERACTABLE_HEALTH, INTERACTABLE_HEALTH_LARGE);
     int index = Interactable_Create(random, position);
 
     interactables[index].textTexture = UI_CreateTextTexture(
@@ -3,18 +3,34 @@
 #include <logs.h>
 #include <stdio.h>
 #include <game.h>
+#include <assets.h>
+#include <asset_loader.h>
 
 #define LOG_COUNT 24
 static SDL_Texture* logTexture[LOG_COUNT];
 
+// The last log has its own image instead of a number
+static void Log_GetPath(int index, char* path) {
+    if (index == LOG_COUNT - 1) {
+        strcpy(path, "Assets/Images/Logs/log-final.png");
+    } else {
+        sprintf(path, "Assets/Images/Logs/log-%02d.png", index);
+    }
+}
+
+void Log_QueueAssets() {
+    for (int i = 1; i < LOG_COUNT; i ++) {
+        char path[50];
+        Log_GetPath(i, path);
+        AssetLoader_QueueImage(path);
+    }
+}
+
 void Log_Start() {
     for (int i = 1; i < LOG_COUNT; i ++) {
         char path[50];
-        sprintf(path, "Assets/Images/Logs/log-%02d.png", i);
-        if (LOG_COUNT == 23) {
-            strcpy(path, "Assets/Images/Logs/log-final.png");
-        }
-        logTexture[i] = IMG_LoadTexture(app.resources.renderer, path);
+        Log_GetPath(i, path);
+        logTexture[i] = Assets_LoadTexture(path);
         if (!logTexture[i]) {
             SDL_Log("Failed to load log texture %d: %s", i, IMG_GetError());
         }
@@ -22,6 +38,13 @@ void Log_Start() {
     
 }
 
+void Log_Quit() {
+    for (int i = 1; i < LOG_COUNT; i++) {
+        Assets_ReleaseTexture(logTexture[i]);
+        logTexture[i] = NULL;
+    }
+}
+
 void Interactable_CreateLog(int logIndex, Vec2 position) {
     int index = Interactable_Create(INTERACTABLE_LOG, position);
     int* data = malloc(sizeof(int));
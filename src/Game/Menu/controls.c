@@ -12,7 +12,11 @@
 #include <input.h>
 #include <sound.h>
 #include <app.h>
-#include <ui_text.h>
+#include <UI_text.h>
+#include <assets.h>
+#include <asset_loader.h>
+
+#define CONTROLS_BACKGROUND_PATH "Assets/Images/UI/controls.png"
 
 AppScene controlLastScene = SCENE_MENU; // Last scene before controls screen
 
@@ -22,6 +26,14 @@ UIElement* ControlsText = NULL;
 SDL_Rect ControlsTextRectBox;
 bool backHovered = false;
 
+/**
+ * @brief Queues the controls background for the startup asset loader
+ */
+void Controls_QueueAssets()
+{
+    AssetLoader_QueueImage(CONTROLS_BACKGROUND_PATH);
+}
+
 /**
  * @brief Initializes the controls screen
  * Loads textures and UI elements needed for the controls screen
@@ -29,7 +41,7 @@ bool backHovered = false;
 void Controls_Start()
 {
     // Load background texture
-    Controls_Background = IMG_LoadTexture(app.resources.renderer, "Assets/Images/UI/controls.png");
+    Controls_Background = Assets_LoadTexture(CONTROLS_BACKGROUND_PATH);
     if (!Controls_Background) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load controls background: %s", IMG_GetError());
     }
@@ -59,6 +71,15 @@ void Controls_Start()
     );
 }
 
+/**
+ * @brief Gives the controls background back to the asset cache
+ */
+void Controls_Quit()
+{
+    Assets_ReleaseTexture(Controls_Background);
+    Controls_Background = NULL;
+}
+
 /**
  * @brief Updates the controls screen state
  * Handles input and interaction with the controls screen
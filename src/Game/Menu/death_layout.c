@@ -16,6 +16,10 @@
 #include <sound.h>
 #include <game.h>  // Added for game stats
 #include <stdio.h> // Added for sprintf function
+#include <assets.h>
+#include <asset_loader.h>
+
+#define DEATH_DIAMOND_ICON_PATH "Assets/Images/Icons/diamond_partial.png"
  
 // UI elements for the death screen
 static SDL_Texture* diamondPartialIcon = NULL;
@@ -312,6 +316,13 @@ void EndScreen_RenderStatsPanel(SDL_Rect headerRect) {
     UI_RenderText(ammoSpentValueElement);
 }
 
+/**
+ * @brief [Start] Queues the icon of the death screen for the startup asset loader
+ */
+void Death_QueueAssets() {
+    AssetLoader_QueueImage(DEATH_DIAMOND_ICON_PATH);
+}
+
 /**
  * @brief [Start] Initializes the death screen UI elements
  * 
@@ -319,7 +330,7 @@ void EndScreen_RenderStatsPanel(SDL_Rect headerRect) {
  * positioning them appropriately on the screen.
  */
 void Death_Start() {
-    diamondPartialIcon = IMG_LoadTexture(app.resources.renderer, "Assets/Images/Icons/diamond_partial.png");
+    diamondPartialIcon = Assets_LoadTexture(DEATH_DIAMOND_ICON_PATH);
     if (!diamondPartialIcon) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load diamond icon: %s", IMG_GetError());
     }
@@ -380,6 +391,14 @@ void Death_Start() {
         app.resources.textFont
     );
 }
+
+/**
+ * @brief [Quit] Gives the diamond icon back to the asset cache
+ */
+void Death_Quit() {
+    Assets_ReleaseTexture(diamondPartialIcon);
+    diamondPartialIcon = NULL;
+}
  
 /**
  * @brief [PostUpdate] Processes user input for the death screen
@@ -6,29 +6,62 @@
 #include <stdio.h>
 #include <interactable.h>
 #include <player.h>
+#include <assets.h>
+#include <asset_loader.h>
+
+#define HUD_HEALTH_ICON_PATH "Assets/Images/Icons/health.png"
+#define HUD_AMMO_ICON_PATH "Assets/Images/Icons/ammo.png"
+#define HUD_GUNS_PATH "Assets/Images/Guns/HUD guns.png"
 
 static SDL_Texture* healthTexture;
 static SDL_Texture* ammoTexture;
+
+// This is the AssetPath, self-explantory, the enum for skills is in player.h
+static const char* skillIconPaths[TOTAL_SKILLS] = {
+    [ARMORED_UP] = "Assets/Images/Icons/abilities/shieldUp.png",
+    [GHOST_LOAD] = "Assets/Images/Icons/abilities/ghostLoad.png",
+    [HEMO_CYCLE] = "Assets/Images/Icons/abilities/hemocycle.png",
+    [KINETIC_ARMOR] = "Assets/Images/Icons/abilities/kineticArmor.png",
+    [LAST_STAND] = "Assets/Images/Icons/abilities/lastStand.png",
+    [OVER_PRESSURED] = "Assets/Images/Icons/abilities/overPressured.png",
+    [SCAVENGER] = "Assets/Images/Icons/abilities/scavenger.png"
+};
+// Regions of the sprite atlas, shared with the ability pickups that use the same icons
+static SpriteRegion skillIcons[TOTAL_SKILLS];
 Vec2 barSize = {120, 14};
 Vec2 iconSize = {10, 10};
 float barX = 10;
 float iconX = 22;
 Animation* HUD_gun = NULL;
 
+// Queues the HUD icons and gun pictures for the startup asset loader
+void HUD_QueueAssets() {
+    AssetLoader_QueueImage(HUD_HEALTH_ICON_PATH);
+    AssetLoader_QueueImage(HUD_AMMO_ICON_PATH);
+    AssetLoader_QueueImage(HUD_GUNS_PATH);
+    for (int i = 0; i < TOTAL_SKILLS; i++) {
+        AssetLoader_QueueImage(skillIconPaths[i]);
+    }
+}
 
 void HUD_Start() {
     // Load textures once and check for errors
-    healthTexture = IMG_LoadTexture(app.resources.renderer, "Assets/Images/Icons/health.png");
+    healthTexture = Assets_LoadTexture(HUD_HEALTH_ICON_PATH);
     if (!healthTexture) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load health texture: %s", SDL_GetError());
     }
 
-    ammoTexture = IMG_LoadTexture(app.resources.renderer, "Assets/Images/Icons/ammo.png");
+    ammoTexture = Assets_LoadTexture(HUD_AMMO_ICON_PATH);
     if (!ammoTexture) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load ammo texture: %s", SDL_GetError());
     }
+    for (int i = 0; i < TOTAL_SKILLS; i++) {
+        if (SpriteAtlas_Load(skillIconPaths[i], &skillIcons[i])) {
+            skillIcons[i] = (SpriteRegion) {NULL, {0, 0, 0, 0}};
+        }
+    }
     AnimationData HUD_gunData = {
-        .spritesheetPath = "Assets/Images/Guns/HUD guns.png",
+        .spritesheetPath = HUD_GUNS_PATH,
         .frameSize = {74,24},
         .frameCount = 12,
         .clips = {
@@ -51,6 +84,14 @@ void HUD_Start() {
     HUD_gun = Animation_Create(&HUD_gunData);
 }
 
+// Gives the HUD icons back to the asset cache
+void HUD_Quit() {
+    Assets_ReleaseTexture(healthTexture);
+    Assets_ReleaseTexture(ammoTexture);
+    healthTexture = NULL;
+    ammoTexture = NULL;
+}
+
 void HUD_RenderBar(Vec2 position, float value, float maxValue, SDL_Texture* icon, const char* text) {
     // Border
     SDL_Rect borderDest = Vec2_ToRect(position, barSize);
@@ -211,17 +252,6 @@ void HUD_RenderSkillIcons() {
     //Okay just in case you wanna change anything in this code, ill explain
     //however in theory it should be simple
 
-    // This is the AssetPath, self-explantory, the enum for skills is in player.h
-    char* AssetPath[TOTAL_SKILLS] = {
-        [ARMORED_UP] = "Assets/Images/Icons/abilities/shieldUp.png",
-        [GHOST_LOAD] = "Assets/Images/Icons/abilities/ghostLoad.png",
-        [HEMO_CYCLE] = "Assets/Images/Icons/abilities/hemocycle.png",
-        [KINETIC_ARMOR] = "Assets/Images/Icons/abilities/kineticArmor.png",
-        [LAST_STAND] = "Assets/Images/Icons/abilities/lastStand.png",
-        [OVER_PRESSURED] = "Assets/Images/Icons/abilities/overPressured.png",
-        [SCAVENGER] = "Assets/Images/Icons/abilities/scavenger.png"
-    };
-
     //This was copilot help, basically i just store the entire struct into an array of bool
     bool skillValues[TOTAL_SKILLS] = {
         player.state.skillState.armoredUp,
@@ -260,8 +290,7 @@ void HUD_RenderSkillIcons() {
     
         //The rest is you alr know it. 
         int width = 40, height = 40;
-        SDL_Texture* pixilFrame2Texture = IMG_LoadTexture(app.resources.renderer, AssetPath[i]);
-        
+        SpriteRegion* icon = &skillIcons[i];
         
         // Create destination rectangle
         SDL_Rect destRect = {
@@ -272,7 +301,7 @@ void HUD_RenderSkillIcons() {
         };
         
         // Render the texture
-        SDL_RenderCopy(app.resources.renderer, pixilFrame2Texture, NULL, &destRect);
+        SDL_RenderCopy(app.resources.renderer, icon->texture, &icon->rect, &destRect);
     }       
 }
 
@@ -17,6 +17,11 @@
 #include <controls.h>
 #include <math.h>
 #include <settings.h>
+#include <assets.h>
+#include <asset_loader.h>
+
+#define MENU_BACKGROUND_PATH "Assets/Images/phagen.png"
+#define MENU_TITLE_PATH "Assets/Images/title.png"
 
 static UIElement* startButtonElement = NULL;
 SDL_Rect startButtonRect = {27, 140, 200, 15};
@@ -28,6 +33,14 @@ static SDL_Texture* title = NULL;
 static SDL_Texture* background = NULL;
 Vec2 backgroundSize = {0, 0};
 
+/**
+ * @brief [Start] Queues the menu background and title for the startup asset loader
+ */
+void Menu_QueueAssets() {
+    AssetLoader_QueueImage(MENU_BACKGROUND_PATH);
+    AssetLoader_QueueImage(MENU_TITLE_PATH);
+}
+
 /**
  * @brief [Start] Loads textures and creates UI elements for the menu
  * 
@@ -37,7 +50,7 @@ Vec2 backgroundSize = {0, 0};
 void Menu_PrepareTextures() {
     SDL_Color textColor = {255, 255, 255, 255};
 
-    background = IMG_LoadTexture(app.resources.renderer, "Assets/Images/phagen.png");
+    background = Assets_LoadTexture(MENU_BACKGROUND_PATH);
     if (!background) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load background texture: %s", SDL_GetError());
     }
@@ -45,13 +58,23 @@ void Menu_PrepareTextures() {
     SDL_QueryTexture(background, NULL, NULL, &backgroundWidth, &backgroundHeight);
     backgroundSize.x = backgroundWidth;
     backgroundSize.y = backgroundHeight;
-    title = IMG_LoadTexture(app.resources.renderer, "Assets/Images/title.png");
+    title = Assets_LoadTexture(MENU_TITLE_PATH);
     startButtonElement = UI_CreateText("Start",(SDL_Rect) {35, 140, 0, 0}, textColor, 1.0f, UI_TEXT_ALIGN_LEFT, app.resources.textFont);
     settingsButtonElement = UI_CreateText("Settings", (SDL_Rect) {35, 160, 0, 0}, textColor, 1.0f, UI_TEXT_ALIGN_LEFT, app.resources.textFont);
     exitButtonElement = UI_CreateText("Exit",  (SDL_Rect) {35, 180, 0, 0}, textColor, 1.0f, UI_TEXT_ALIGN_LEFT, app.resources.textFont);
     Sound_Play_Music("Assets/Audio/Music/mainMenu.wav", -1);
 }
 
+/**
+ * @brief [Quit] Gives the menu background and title back to the asset cache
+ */
+void Menu_Quit() {
+    Assets_ReleaseTexture(background);
+    Assets_ReleaseTexture(title);
+    background = NULL;
+    title = NULL;
+}
+
 /**
  * @brief [PostUpdate] Processes user input for menu buttons
  * 
@@ -12,10 +12,37 @@
 #include <maps.h>
 #include <app.h>
 #include <minimap.h>
+#include <assets.h>
+#include <asset_loader.h>
+#include <profiler.h>
+
+#define MINIMAP_PLAYER_INDICATOR_PATH "Assets/Images/Tiles/player-minimap.png"
 
 SDL_Rect minimapPosition = {0, 0, 0, 0};
 SDL_Texture* playerIndicator = NULL;
 
+/**
+ * @brief Cached minimap layer holding the background, rooms and hallways
+ */
+static SDL_Texture* minimapLayer = NULL;
+
+/**
+ * @brief Whether minimapLayer has to be redrawn before the next render
+ */
+static bool minimapDirty = true;
+
+/**
+ * @brief Minimap position of chunk (0, 0), chosen so the rooms of the map are centered
+ */
+static Vec2 minimapOrigin = {0, 0};
+
+/**
+ * @brief [Start] Queues the player indicator for the startup asset loader
+ */
+void Minimap_QueueAssets() {
+    AssetLoader_QueueImage(MINIMAP_PLAYER_INDICATOR_PATH);
+}
+
 /**
  * @brief [Start] Initializes the minimap system
  * 
@@ -29,25 +56,110 @@ void Minimap_Start() {
         MINIMAP_SIZE,
         MINIMAP_SIZE
     };
-    playerIndicator = IMG_LoadTexture(app.resources.renderer, "Assets/Images/Tiles/player-minimap.png");
+    playerIndicator = Assets_LoadTexture(MINIMAP_PLAYER_INDICATOR_PATH);
+
+    minimapLayer = SDL_CreateTexture(
+        app.resources.renderer,
+        SDL_PIXELFORMAT_RGBA8888,
+        SDL_TEXTUREACCESS_TARGET,
+        MINIMAP_SIZE,
+        MINIMAP_SIZE
+    );
+    if (!minimapLayer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create minimap layer: %s", SDL_GetError());
+    } else {
+        PROFILER_COUNT(PROFILER_COUNTER_TEXTURES_CREATED, 1);
+    }
+    SDL_SetTextureBlendMode(minimapLayer, SDL_BLENDMODE_BLEND);
+    minimapDirty = true;
 }
 
 /**
- * @brief [Render] Renders the minimap to the screen
+ * @brief [Quit] Destroys the minimap layer and gives the player indicator back to the asset cache
+ */
+void Minimap_Quit() {
+    if (minimapLayer) SDL_DestroyTexture(minimapLayer);
+    minimapLayer = NULL;
+    Assets_ReleaseTexture(playerIndicator);
+    playerIndicator = NULL;
+}
+
+/**
+ * @brief [Utility] Marks the minimap layer for a redraw
  * 
- * Draws the background and all visible chunks on the minimap,
- * representing the explored and visible parts of the game world.
+ * Call whenever something the minimap shows changes: a new map, a room
+ * being discovered, or a room entering or leaving combat.
  */
-void Minimap_Render() {
+void Minimap_Invalidate() {
+    minimapDirty = true;
+}
+
+/**
+ * @brief [Render] Redraws the cached minimap layer
+ * 
+ * Draws the background and all visible chunks into minimapLayer,
+ * in minimap-local coordinates.
+ */
+static void Minimap_RebuildLayer() {
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(app.resources.renderer);
+    if (SDL_SetRenderTarget(app.resources.renderer, minimapLayer) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to draw minimap layer: %s", SDL_GetError());
+        return;
+    }
+
+    // Center the bounding box of the rooms, the grid itself can be larger than the minimap
+    Vec2 boundsMin = {testMap.width, testMap.height};
+    Vec2 boundsMax = {0, 0};
+    for (int i = 0; i < testMap.chunkCount; i++) {
+        boundsMin = Vec2_Min(boundsMin, testMap.chunks[i].position);
+        boundsMax = Vec2_Max(boundsMax, testMap.chunks[i].position);
+    }
+    minimapOrigin = (Vec2) {
+        (MINIMAP_SIZE - (boundsMin.x + boundsMax.x) * MINIMAP_CHUNK_SIZE) / 2,
+        (MINIMAP_SIZE - (boundsMin.y + boundsMax.y) * MINIMAP_CHUNK_SIZE) / 2
+    };
+
     SDL_SetRenderDrawColor(app.resources.renderer, 0, 0, 0, 100);
-    SDL_RenderFillRect(app.resources.renderer, &minimapPosition);
-    for (int x = 0; x < MAP_SIZE_CHUNK; x++) {
-        for (int y = 0; y < MAP_SIZE_CHUNK; y++) {
-            EnvironmentChunk* chunk = &testMap.chunks[x][y];
-            if (!Minimap_ChunkIsVisible(chunk) || chunk->empty) continue;
-            Minimap_RenderChunk(chunk);
-        }
+    SDL_RenderClear(app.resources.renderer);
+    for (int i = 0; i < testMap.chunkCount; i++) {
+        EnvironmentChunk* chunk = &testMap.chunks[i];
+        if (!Minimap_ChunkIsVisible(chunk)) continue;
+        Minimap_RenderChunk(chunk);
     }
+
+    SDL_SetRenderTarget(app.resources.renderer, previousTarget);
+    minimapDirty = false;
+}
+
+/**
+ * @brief [Render] Renders the minimap to the screen
+ * 
+ * Copies the cached layer of explored and visible rooms, redrawing it
+ * first if it was invalidated, then draws the player indicator on top.
+ */
+void Minimap_Render() {
+    if (minimapDirty && minimapLayer) Minimap_RebuildLayer();
+    SDL_RenderCopy(app.resources.renderer, minimapLayer, NULL, &minimapPosition);
+
+    EnvironmentChunk* playerChunk = Chunk_GetCurrentChunk(player.state.position);
+    if (!playerChunk || !Minimap_ChunkIsVisible(playerChunk)) return;
+    Vec2 roomPosition = Vec2_Add(
+        Minimap_GetMinimapChunkPosition(playerChunk),
+        (Vec2) {minimapPosition.x, minimapPosition.y}
+    );
+    SDL_Rect playerRect = Vec2_ToCenteredRect(
+        roomPosition, 
+        (Vec2) {
+            MINIMAP_CHUNK_SIZE, 
+            MINIMAP_CHUNK_SIZE
+        }   
+    );
+    SDL_RenderCopy(
+        app.resources.renderer,
+        playerIndicator,
+        NULL,
+        &playerRect
+    );
 }
 
 /**
@@ -66,8 +178,7 @@ void Minimap_RenderChunk(EnvironmentChunk *chunk) {
 /**
  * @brief [Render] Renders a room on the minimap
  * 
- * Draws a room with appropriate colors based on its type
- * and adds a player indicator if the player is in this room.
+ * Draws a room with appropriate colors based on its type.
  * 
  * @param chunk Pointer to the chunk containing the room
  */
@@ -92,22 +203,6 @@ void Minimap_RenderChunkRoom(EnvironmentChunk *chunk) {
     );
     SDL_SetRenderDrawColor(app.resources.renderer, innerColor.r, innerColor.g, innerColor.b, innerColor.a);
     SDL_RenderFillRect(app.resources.renderer, &innerRect);
-
-    if (Chunk_GetCurrentChunk(player.state.position) == chunk) {
-        SDL_Rect playerRect = Vec2_ToCenteredRect(
-            roomPosition, 
-            (Vec2) {
-                MINIMAP_CHUNK_SIZE, 
-                MINIMAP_CHUNK_SIZE
-            }   
-        );
-        SDL_RenderCopy(
-            app.resources.renderer,
-            playerIndicator,
-            NULL,
-            &playerRect
-        );
-    }
 }
 
 /**
@@ -204,9 +299,10 @@ SDL_Color Minimap_GetRoomColor(EnvironmentChunk *chunk) {
 }
 
 /**
- * @brief [Utility] Converts chunk position to minimap screen position
+ * @brief [Utility] Converts chunk position to minimap position
  * 
- * Calculates the screen coordinates for a chunk on the minimap.
+ * Calculates the coordinates of a chunk relative to the top left of
+ * the minimap, which is how the cached layer is drawn.
  * 
  * @param chunk Pointer to the chunk
  * @return Vec2 Position of the chunk on the minimap
@@ -214,8 +310,8 @@ SDL_Color Minimap_GetRoomColor(EnvironmentChunk *chunk) {
 Vec2 Minimap_GetMinimapChunkPosition(EnvironmentChunk *chunk) {
     Vec2 chunkPosition = chunk->position;
     Vec2 roomPosition = (Vec2) {
-        minimapPosition.x + MINIMAP_MARGIN + chunkPosition.x * MINIMAP_CHUNK_SIZE,
-        minimapPosition.y + MINIMAP_MARGIN + chunkPosition.y * MINIMAP_CHUNK_SIZE
+        minimapOrigin.x + chunkPosition.x * MINIMAP_CHUNK_SIZE,
+        minimapOrigin.y + chunkPosition.y * MINIMAP_CHUNK_SIZE
     };
     return Vec2_ToCenteredPosition(
         roomPosition, 
@@ -233,32 +329,17 @@ Vec2 Minimap_GetMinimapChunkPosition(EnvironmentChunk *chunk) {
  * @return RoomHallways Bitmask of visible hallway directions
  */
 RoomHallways Minimap_GetHallways(EnvironmentChunk *chunk) {
-    Vec2 chunkPosition = chunk->position;
+    int x = (int) chunk->position.x;
+    int y = (int) chunk->position.y;
     RoomHallways hallways = HALLWAY_NONE;
-    if (chunkPosition.y > 0) {
-        EnvironmentChunk* topChunk = &testMap.chunks[(int) chunkPosition.x][(int) chunkPosition.y - 1];
-        if (topChunk && !topChunk->empty && Minimap_ChunkIsVisible(topChunk)) {
-            hallways |= HALLWAY_UP;
-        }
-    }
-    if (chunkPosition.y < MAP_SIZE_CHUNK - 1) {
-        EnvironmentChunk* bottomChunk = &testMap.chunks[(int) chunkPosition.x][(int) chunkPosition.y + 1];
-        if (bottomChunk && !bottomChunk->empty && Minimap_ChunkIsVisible(bottomChunk)) {
-            hallways |= HALLWAY_DOWN;
-        }
-    }
-    if (chunkPosition.x > 0) {
-        EnvironmentChunk* leftChunk = &testMap.chunks[(int) chunkPosition.x - 1][(int) chunkPosition.y];
-        if (leftChunk && !leftChunk->empty && Minimap_ChunkIsVisible(leftChunk)) {
-            hallways |= HALLWAY_LEFT;
-        }
-    }
-    if (chunkPosition.x < MAP_SIZE_CHUNK - 1) {
-        EnvironmentChunk* rightChunk = &testMap.chunks[(int) chunkPosition.x + 1][(int) chunkPosition.y];
-        if (rightChunk && !rightChunk->empty && Minimap_ChunkIsVisible(rightChunk)) {
-            hallways |= HALLWAY_RIGHT;
-        }
-    }
+    EnvironmentChunk* topChunk = Map_GetChunk(&testMap, x, y - 1);
+    if (topChunk && Minimap_ChunkIsVisible(topChunk)) hallways |= HALLWAY_UP;
+    EnvironmentChunk* bottomChunk = Map_GetChunk(&testMap, x, y + 1);
+    if (bottomChunk && Minimap_ChunkIsVisible(bottomChunk)) hallways |= HALLWAY_DOWN;
+    EnvironmentChunk* leftChunk = Map_GetChunk(&testMap, x - 1, y);
+    if (leftChunk && Minimap_ChunkIsVisible(leftChunk)) hallways |= HALLWAY_LEFT;
+    EnvironmentChunk* rightChunk = Map_GetChunk(&testMap, x + 1, y);
+    if (rightChunk && Minimap_ChunkIsVisible(rightChunk)) hallways |= HALLWAY_RIGHT;
     return hallways;
 }
 
@@ -272,22 +353,15 @@ RoomHallways Minimap_GetHallways(EnvironmentChunk *chunk) {
  */
 bool Minimap_ChunkIsVisible(EnvironmentChunk *chunk) {
     if (chunk->discovered) return true;
-    Vec2 chunkPosition = chunk->position;
-    if (chunkPosition.y > 0) {
-        EnvironmentChunk* topChunk = &testMap.chunks[(int) chunkPosition.x][(int) chunkPosition.y - 1];
-        if (topChunk && topChunk->discovered) return true;
-    }
-    if (chunkPosition.y < MAP_SIZE_CHUNK - 1) {
-        EnvironmentChunk* bottomChunk = &testMap.chunks[(int) chunkPosition.x][(int) chunkPosition.y + 1];
-        if (bottomChunk && bottomChunk->discovered) return true;
-    }
-    if (chunkPosition.x > 0) {
-        EnvironmentChunk* leftChunk = &testMap.chunks[(int) chunkPosition.x - 1][(int) chunkPosition.y];
-        if (leftChunk && leftChunk->discovered) return true;
-    }
-    if (chunkPosition.x < MAP_SIZE_CHUNK - 1) {
-        EnvironmentChunk* rightChunk = &testMap.chunks[(int) chunkPosition.x + 1][(int) chunkPosition.y];
-        if (rightChunk && rightChunk->discovered) return true;
-    }
+    int x = (int) chunk->position.x;
+    int y = (int) chunk->position.y;
+    EnvironmentChunk* topChunk = Map_GetChunk(&testMap, x, y - 1);
+    if (topChunk && topChunk->discovered) return true;
+    EnvironmentChunk* bottomChunk = Map_GetChunk(&testMap, x, y + 1);
+    if (bottomChunk && bottomChunk->discovered) return true;
+    EnvironmentChunk* leftChunk = Map_GetChunk(&testMap, x - 1, y);
+    if (leftChunk && leftChunk->discovered) return true;
+    EnvironmentChunk* rightChunk = Map_GetChunk(&testMap, x + 1, y);
+    if (rightChunk && rightChunk->discovered) return true;
     return false;
 }
\ No newline at end of file
@@ -2,16 +2,25 @@
 #include <input.h>
 #include <sound.h>
 #include <app.h>
-#include <ui_text.h>
+#include <UI_text.h>
+#include <assets.h>
+#include <asset_loader.h>
+
+#define MISSION_BACKGROUND_PATH "Assets/Images/UI/mission_briefing.png"
 
 SDL_Texture* Mission_Background = NULL;
 UIElement* MissionText = NULL;
 SDL_Rect MissionTextRectBox;
 bool continueHovered = false;
 
+void Mission_QueueAssets()
+{
+    AssetLoader_QueueImage(MISSION_BACKGROUND_PATH);
+}
+
 void Mission_Start()
 {
-    Mission_Background = IMG_LoadTexture(app.resources.renderer, "Assets/Images/UI/mission_briefing.png");
+    Mission_Background = Assets_LoadTexture(MISSION_BACKGROUND_PATH);
     if (!Mission_Background) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load mission briefing background: %s", IMG_GetError());
     }
@@ -38,6 +47,12 @@ void Mission_Start()
 
 }
 
+void Mission_Quit()
+{
+    Assets_ReleaseTexture(Mission_Background);
+    Mission_Background = NULL;
+}
+
 void Mission_Update()
 {
     if (Input_MouseIsOnRect(MissionTextRectBox)) {
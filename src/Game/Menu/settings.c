@@ -1,7 +1,7 @@
 #include <stdio.h>
 #include <settings.h>
 #include <input.h>
-#include <ui_text.h>
+#include <UI_text.h>
 #include <sound.h>
 #include <math.h>
 #include <SDL_filesystem.h>
@@ -37,7 +37,8 @@ typedef enum {
 
 typedef enum {
     SETTING_TYPE_TOGGLE,
-    SETTING_TYPE_SLIDER
+    SETTING_TYPE_SLIDER,
+    SETTING_TYPE_OPTIONS    // Cycles through a fixed list of values when clicked
 } SettingType;
 
 // Video settings enum
@@ -48,9 +49,19 @@ typedef enum {
     SETTING_SCREEN_SHAKE,
     SETTING_CAMERA_SMOOTHING,
     SETTING_HIDE_PARTICLES,
+    SETTING_VSYNC,
+    SETTING_FPS_CAP,
     VIDEO_SETTINGS_COUNT
 } VideoSetting;
 
+// Video settings stored by settings files of version 1
+#define VIDEO_SETTINGS_COUNT_V1 (SETTING_HIDE_PARTICLES + 1)
+
+// Frame rate limits offered by the FPS cap setting, 0 means uncapped
+static const int fpsCapOptions[] = {0, 30, 60, 120, 144, 240};
+static const char* fpsCapLabels[] = {"Off", "30", "60", "120", "144", "240"};
+#define FPS_CAP_OPTION_COUNT (int) (sizeof(fpsCapOptions) / sizeof(fpsCapOptions[0]))
+
 // Structure to hold setting data
 typedef struct {
     const char* label;
@@ -58,6 +69,7 @@ typedef struct {
     union {
         bool toggleValue;
         float sliderValue;
+        int optionIndex;
     };
     UIElement* labelElement;
     union {
@@ -113,6 +125,12 @@ static SDL_Rect backButtonRect;
 #define SETTING_BUTTON_HITBOX(x) BUTTONS_ENDX - 20, SETTING_TAB_STARTY + (x) * (SETTING_TAB_SPACING), 20, SETTING_TAB_SPACING
 #define CREATE_SETTING_BUTTON(x, text) UI_CreateText(text, (SDL_Rect) {SETTING_BUTTON_RECT(x)}, textColor, 1.0f, UI_TEXT_ALIGN_RIGHT, app.resources.textFont)
 
+// The video tab has more rows than fit at SETTING_TAB_SPACING, so they are packed tighter
+#define VIDEO_TAB_SPACING 16
+#define VIDEO_LABEL_RECT(x) BUTTONS_STARTX, SETTING_TAB_STARTY + (x) * (VIDEO_TAB_SPACING), 0, 0
+#define VIDEO_BUTTON_RECT(x) BUTTONS_ENDX, SETTING_TAB_STARTY + (x) * (VIDEO_TAB_SPACING), 0, 0
+#define VIDEO_BUTTON_HITBOX(x) BUTTONS_ENDX - 20, SETTING_TAB_STARTY + (x) * (VIDEO_TAB_SPACING), 20, VIDEO_TAB_SPACING
+
 #define SLIDER_WIDTH 200
 #define SLIDER_HEIGHT 15
 #define SLIDER_BORDER 2
@@ -199,6 +217,24 @@ void InitializeSettings() {
         .type = SETTING_TYPE_TOGGLE,
         .toggleValue = false
     };
+    videoSettings[SETTING_VSYNC] = (SettingData){
+        .label = "VSync",
+        .type = SETTING_TYPE_TOGGLE,
+        .toggleValue = true
+    };
+    videoSettings[SETTING_FPS_CAP] = (SettingData){
+        .label = "FPS Cap",
+        .type = SETTING_TYPE_OPTIONS,
+        .optionIndex = 0
+    };
+}
+
+// Helper function to get the text shown on a video setting's button
+static const char* GetVideoSettingText(int index) {
+    if (videoSettings[index].type == SETTING_TYPE_OPTIONS) {
+        return fpsCapLabels[videoSettings[index].optionIndex];
+    }
+    return videoSettings[index].toggleValue ? "On" : "Off";
 }
 
 // Helper function to update slider value based on mouse position
@@ -322,8 +358,8 @@ void Settings_Start() {
 
     // Video settings
     for (int i = 0; i < VIDEO_SETTINGS_COUNT; i++) {
-        videoSettings[i].labelElement = CREATE_SETTING_LABEL(i, videoSettings[i].label);
-        videoSettings[i].buttonElement = CREATE_SETTING_BUTTON(i, videoSettings[i].toggleValue ? "On" : "Off");
+        videoSettings[i].labelElement = UI_CreateText(videoSettings[i].label, (SDL_Rect) {VIDEO_LABEL_RECT(i)}, textColor, 1.0f, UI_TEXT_ALIGN_LEFT, app.resources.textFont);
+        videoSettings[i].buttonElement = UI_CreateText(GetVideoSettingText(i), (SDL_Rect) {VIDEO_BUTTON_RECT(i)}, textColor, 1.0f, UI_TEXT_ALIGN_RIGHT, app.resources.textFont);
     }
 
     InitializeKeybindUI();
@@ -497,10 +533,18 @@ void Settings_Update() {
         UI_ChangeText(videoSettings[SETTING_FULLSCREEN].buttonElement, videoSettings[SETTING_FULLSCREEN].toggleValue ? "On" : "Off");
         UI_UpdateText(videoSettings[SETTING_FULLSCREEN].buttonElement);
         for (int i = 0; i < VIDEO_SETTINGS_COUNT; i++) {
-            if (Input_MouseIsOnRect((SDL_Rect) {SETTING_BUTTON_HITBOX(i)}) && Input->mouse.leftButton.pressed) {
-                videoSettings[i].toggleValue = !videoSettings[i].toggleValue;
-                UI_ChangeText(videoSettings[i].buttonElement, videoSettings[i].toggleValue ? "On" : "Off");
+            if (Input_MouseIsOnRect((SDL_Rect) {VIDEO_BUTTON_HITBOX(i)}) && Input->mouse.leftButton.pressed) {
+                if (videoSettings[i].type == SETTING_TYPE_OPTIONS) {
+                    videoSettings[i].optionIndex = (videoSettings[i].optionIndex + 1) % FPS_CAP_OPTION_COUNT;
+                } else {
+                    videoSettings[i].toggleValue = !videoSettings[i].toggleValue;
+                }
+                UI_ChangeText(videoSettings[i].buttonElement, GetVideoSettingText(i));
                 UI_UpdateText(videoSettings[i].buttonElement);
+                // Apply vsync right away, the renderer supports switching it since SDL 2.0.18
+                if (i == SETTING_VSYNC) {
+                    SDL_RenderSetVSync(app.resources.renderer, videoSettings[i].toggleValue);
+                }
                 // Handle fullscreen toggle immediately
                 if (i == SETTING_FULLSCREEN) {
                     app.config.window_fullscreen = videoSettings[i].toggleValue;
@@ -733,6 +777,14 @@ bool Settings_GetHideParticles() {
     return videoSettings[SETTING_HIDE_PARTICLES].toggleValue;
 }
 
+bool Settings_GetVSync() {
+    return videoSettings[SETTING_VSYNC].toggleValue;
+}
+
+int Settings_GetFPSCap() {
+    return fpsCapOptions[videoSettings[SETTING_FPS_CAP].optionIndex];
+}
+
 void Settings_Migrate(int oldVersion) {
     // When adding new settings, add migration code here
     switch(oldVersion) {
@@ -742,12 +794,32 @@ void Settings_Migrate(int oldVersion) {
             break;
             
         // Add more cases as you add new settings versions
-        // case 1:
-        //     // Migrate from version 1 to 2
-        //     break;
+        // Version 1 files are read directly by Settings_Load(), the settings added in version 2 keep their defaults
+    }
+}
+
+// Helper functions to store a video setting according to its type
+static void WriteVideoSetting(FILE* file, SettingData* setting) {
+    if (setting->type == SETTING_TYPE_OPTIONS) {
+        fwrite(&setting->optionIndex, sizeof(int), 1, file);
+    } else {
+        fwrite(&setting->toggleValue, sizeof(bool), 1, file);
+    }
+}
+
+static void ReadVideoSetting(FILE* file, SettingData* setting) {
+    if (setting->type == SETTING_TYPE_OPTIONS) {
+        fread(&setting->optionIndex, sizeof(int), 1, file);
+        if (setting->optionIndex < 0 || setting->optionIndex >= FPS_CAP_OPTION_COUNT) setting->optionIndex = 0;
+    } else {
+        fread(&setting->toggleValue, sizeof(bool), 1, file);
     }
 }
 
+static long VideoSettingSize(SettingData* setting) {
+    return setting->type == SETTING_TYPE_OPTIONS ? sizeof(int) : sizeof(bool);
+}
+
 static char* GetSettingsPath() {
     char* prefPath = SDL_GetPrefPath("Operation-Null-Mind", "Settings");
     if (prefPath == NULL) {
@@ -790,7 +862,7 @@ void Settings_Save() {
             fwrite(&audioSettings[i].sliderValue, sizeof(float), 1, file);
         }
         for (int i = 0; i < VIDEO_SETTINGS_COUNT; i++) {
-            fwrite(&videoSettings[i].toggleValue, sizeof(bool), 1, file);
+            WriteVideoSetting(file, &videoSettings[i]);
         }
         // Save key bindings using the helper
         Input_SaveBindings(file);
@@ -820,7 +892,9 @@ void Settings_Load() {
             return;
         }
 
-        if (version != SETTINGS_VERSION) {
+        // Version 1 only lacks the last video settings, so it is still read
+        int videoSettingCount = version == 1 ? VIDEO_SETTINGS_COUNT_V1 : VIDEO_SETTINGS_COUNT;
+        if (version != SETTINGS_VERSION && version != 1) {
             // Version mismatch - close file and migrate
             fclose(file);
             Settings_Migrate(version);
@@ -829,10 +903,14 @@ void Settings_Load() {
         }
 
         // Calculate expected file size
+        long videoSettingsSize = 0;
+        for (int i = 0; i < videoSettingCount; i++) {
+            videoSettingsSize += VideoSettingSize(&videoSettings[i]);
+        }
         long expectedSize = sizeof(int) + // Version number
                           (GAMEPLAY_SETTINGS_COUNT * sizeof(bool)) +  // Gameplay settings
                           (AUDIO_SETTINGS_COUNT * sizeof(float)) +    // Audio settings
-                          (VIDEO_SETTINGS_COUNT * sizeof(bool)) +     // Video settings
+                          videoSettingsSize +                         // Video settings
                           (ACTION_COUNT * sizeof(ActionBinding));      // Key bindings
 
         // Get actual file size
@@ -859,8 +937,8 @@ void Settings_Load() {
         for (int i = 0; i < AUDIO_SETTINGS_COUNT; i++) {
             fread(&audioSettings[i].sliderValue, sizeof(float), 1, file);
         }
-        for (int i = 0; i < VIDEO_SETTINGS_COUNT; i++) {
-            fread(&videoSettings[i].toggleValue, sizeof(bool), 1, file);
+        for (int i = 0; i < videoSettingCount; i++) {
+            ReadVideoSetting(file, &videoSettings[i]);
         }
         // Load key bindings using the helper
         Input_LoadBindings(file);
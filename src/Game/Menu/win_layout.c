@@ -16,6 +16,10 @@
 #include <sound.h>
 #include <game.h>  // Added for game stats
 #include <stdio.h> // Added for sprintf function
+#include <assets.h>
+#include <asset_loader.h>
+
+#define WIN_DIAMOND_ICON_PATH "Assets/Images/Icons/diamond_full.png"
  
 // UI elements for the win screen
 static SDL_Texture* diamondFullIcon = NULL;
@@ -42,6 +46,13 @@ extern UIElement* ammoSpentValueElement;
 static UIElement* returnButtonElement = NULL;
 static SDL_Rect returnButtonRect = {0, 0, 130, 30};
 
+/**
+ * @brief [Start] Queues the icon of the win screen for the startup asset loader
+ */
+void Win_QueueAssets() {
+    AssetLoader_QueueImage(WIN_DIAMOND_ICON_PATH);
+}
+
 /**
  * @brief [Start] Initializes the win screen UI elements
  * 
@@ -49,7 +60,7 @@ static SDL_Rect returnButtonRect = {0, 0, 130, 30};
  * positioning them appropriately on the screen.
  */
 void Win_Start() {
-    diamondFullIcon = IMG_LoadTexture(app.resources.renderer, "Assets/Images/Icons/diamond_full.png");
+    diamondFullIcon = Assets_LoadTexture(WIN_DIAMOND_ICON_PATH);
     if (!diamondFullIcon) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load diamond full icon: %s", IMG_GetError());
     }
@@ -110,6 +121,14 @@ void Win_Start() {
         app.resources.textFont
     );
 }
+
+/**
+ * @brief [Quit] Gives the diamond icon back to the asset cache
+ */
+void Win_Quit() {
+    Assets_ReleaseTexture(diamondFullIcon);
+    diamondFullIcon = NULL;
+}
  
 /**
  * @brief [PostUpdate] Processes user input for the win screen
@@ -13,6 +13,14 @@
 
 #include <player.h>
 #include <app.h>
+#include <asset_loader.h>
+
+/**
+ * @brief [Start] Queues the player spritesheet for the startup asset loader
+ */
+void Player_QueueAssets() {
+    AssetLoader_QueueImage(player.animData.spritesheetPath);
+}
 
 /**
  * @brief [Start] Initializes the player's animation system
@@ -97,7 +97,7 @@ void Player_Shoot() {
         player.state.currentAmmo += ammoComsumption;
     }
 
-    player.resources.shootCooldownTimer = Timer_Create((60.0f /(gun->stats.fireRate * player.resources.skillResources.overPressuredFireRate)) + player.resources.skillResources.ghostLoadRandomizer);
+    Timer_SetDuration(player.resources.shootCooldownTimer, (60.0f /(gun->stats.fireRate * player.resources.skillResources.overPressuredFireRate)) + player.resources.skillResources.ghostLoadRandomizer);
     Timer_Start(player.resources.shootCooldownTimer);
     
 }
@@ -114,7 +114,7 @@ void Player_SwitchGun() {
     }
     player.state.gunSlots[i] = temp;
     player.state.currentGun = GunList[player.state.gunSlots[0]];
-    player.resources.shootCooldownTimer = Timer_Create(60.0f/player.state.currentGun.stats.fireRate);
+    Timer_SetDuration(player.resources.shootCooldownTimer, 60.0f/player.state.currentGun.stats.fireRate);
     Timer_Start(player.resources.shootCooldownTimer);
 }
 
@@ -148,7 +148,7 @@ void Player_PickUpGun(void* data, int interactableIndex) {
 
     Sound_Play_Effect(SOUND_GUN_PICKUP);
     Interactable_Deactivate(interactableIndex);
-    player.resources.shootCooldownTimer = Timer_Create(60.0f/GunList[gun->type].stats.fireRate);
+    Timer_SetDuration(player.resources.shootCooldownTimer, 60.0f/GunList[gun->type].stats.fireRate);
     Timer_Start(player.resources.shootCooldownTimer);
 }
 
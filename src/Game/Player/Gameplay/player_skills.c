@@ -310,10 +310,11 @@ int Player_ParryRenderCircleVFX()
     Vec2 mouseDirection = player.resources.skillResources.parryDirection;
 
 
-    player.resources.skillResources.parryTexture = CreateHalfCircleOutlineTexture(100 , mouseDirection, (SDL_Color){3, 252, 232, 255}, 10);
+    // Cached once and pointed at the mouse direction by rotating the copy
+    player.resources.skillResources.parryTexture = GetCachedHalfCircleTexture(100, (SDL_Color){3, 252, 232, 255}, 10);
+    float angle = atan2f(mouseDirection.y, mouseDirection.x) * 180.0f / M_PI;
     
-    player.resources.skillResources.parryRadius += 1000.0f * Time->deltaTimeSeconds; //This is the speed of the parry radius growing, it should be 700.0f
-    float radius =  player.resources.skillResources.parryRadius; //Because the radius is in time, if the game lags the radius actually gets smaller xd
+    float radius =  player.resources.skillResources.parryRadius; // Grown in Player_HandleParry(), once per simulation step
 
     // Set opacity based on time left
     SDL_SetTextureAlphaMod(
@@ -328,7 +329,7 @@ int Player_ParryRenderCircleVFX()
         radius
      ); 
 
-    SDL_RenderCopy(app.resources.renderer, player.resources.skillResources.parryTexture, NULL, &dest);
+    SDL_RenderCopyEx(app.resources.renderer, player.resources.skillResources.parryTexture, NULL, &dest, angle, NULL, SDL_FLIP_NONE);
     return 0;
 }
 
@@ -337,6 +338,7 @@ int Player_HandleParry()
     
     //Check if parry is active
     if(!player.state.skillState.parryActive) return 1;
+    player.resources.skillResources.parryRadius += 1000.0f * Time->deltaTimeSeconds; //This is the speed of the parry radius growing, it should be 700.0f
     //Deactivate parry after the timer is finished
     if(Timer_IsFinished(player.resources.skillResources.parryDurationTimer))
     {
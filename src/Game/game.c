@@ -1,11 +1,15 @@
 #include <game.h>
 #include <enemy.h>
 #include <sound.h>
+#include <frame_arena.h>
+#include <random.h>
+#include <time.h>
 
 bool currentStageIncreased = false;
 
 GameData game = {
     .currentStage = 1,
+    .seed = 0,
     .isTransitioning = false,
     .viewingLog = -1,
     .transitionTimer = NULL,
@@ -16,6 +20,25 @@ GameData game = {
     .healingItemsUsed = 0
 };
 
+/**
+ * Picks the seed of a new run, --seed makes every run the same
+ */
+static void Game_PickSeed() {
+    game.seed = app.config.seed > 0 ? (Uint64) app.config.seed : (Uint64) time(NULL) ^ SDL_GetPerformanceCounter();
+    SDL_Log("Run seed: %llu", (unsigned long long) game.seed);
+    RandomInit(game.seed);
+}
+
+/**
+ * Returns the seed the map of a stage is generated with
+ * 
+ * @param stage The stage
+ * @return Uint64 The seed, the same for the same run and stage
+ */
+Uint64 Game_GetStageSeed(int stage) {
+    return game.seed ^ ((Uint64) stage * 0x9E3779B97F4A7C15ULL);
+}
+
 void Game_Start() {
     game.transitionTimer = Timer_Create(2.5f);
     // Initialize game stats
@@ -41,8 +64,9 @@ void Game_Update() {
         }
         if (!Timer_IsFinished(game.transitionTimer)) return;
         game.isTransitioning = false;
-        Map_Generate(); 
-        player.state.position = Chunk_GetChunkCenter(&testMap.chunks[3][3]);
+        // The layout was generated while the transition played
+        Map_FinishBackgroundGeneration();
+        player.state.position = Chunk_GetChunkCenter(testMap.startChunk);
         player.state.position.y += 20;
         camera.position = player.state.position;
     }
@@ -62,13 +86,14 @@ void Game_Restart()
     player.state.gunSlots[0] = GUN_PISTOL;
     player.state.gunSlots[1] = -1;
     player.state.skillState = (SkillState) {false};
+    Game_PickSeed();
     Map_Generate(); 
-    player.state.position = Chunk_GetChunkCenter(&testMap.chunks[3][3]);
+    player.state.position = Chunk_GetChunkCenter(testMap.startChunk);
     player.state.position.y += 20;
     camera.position = player.state.position;
     Sound_Play_Music("Assets/Audio/Music/return0 lofi death music BEGINNING.wav", 1);
 
-    for(int i = 0;i < ENEMY_MAX;i++)
+    for(int i = 0;i < Enemy_Capacity;i++)
     {
         EnemyData* enemy = &enemies[i];
         Enemy_HandleDeath(enemy);
@@ -106,6 +131,8 @@ void Game_TransitionNextLevel(void* data, int interactableIndex) {
     if (game.isTransitioning) return;
     if (app.state.currentScene == SCENE_MISSION_BRIEFING) {
         game.currentStage--;
+        // Leaving the briefing starts a new run
+        Game_PickSeed();
     }
     if (game.currentStage == 10) {
         app.state.currentScene = SCENE_WIN;
@@ -115,25 +142,24 @@ void Game_TransitionNextLevel(void* data, int interactableIndex) {
     game.isTransitioning = true;
     Timer_Start(game.transitionTimer);
     currentStageIncreased = false;
+    // Generate the stage the transition leads to while it plays
+    Map_GenerateInBackground(game.currentStage + 1, Game_GetStageSeed(game.currentStage + 1));
 }
 
 void Game_QueueNextMusic() {
-    char* path = Game_GetCurrentMusic();
-    Sound_Queue_Next_Song(path);
-    free(path);
+    Sound_Queue_Next_Song(Game_GetCurrentMusic());
 }
 
 void Game_PlayCurrentMusic() {
-    char* path = Game_GetCurrentMusic();
-    Sound_Play_Music(path, 0);
-    free(path);
+    Sound_Play_Music(Game_GetCurrentMusic(), 0);
 }
 
+// The path lives in the frame arena, don't free it or keep it past this frame
 char* Game_GetCurrentMusic() {
-    char* path = malloc(sizeof(char) * 100);
-    if(game.currentStage < 4) strcpy(path, "Assets/Audio/Music/return0 early level music.wav");
-    else if (game.currentStage < 7) strcpy(path, "Assets/Audio/Music/return0 mid level music.wav");
-    else if (game.currentStage < 10) strcpy(path, "Assets/Audio/Music/return0 late level music.wav");
-    else strcpy(path, "Assets/Audio/Music/return0 boss music.wav");
-    return path;
+    const char* path;
+    if(game.currentStage < 4) path = "Assets/Audio/Music/return0 early level music.wav";
+    else if (game.currentStage < 7) path = "Assets/Audio/Music/return0 mid level music.wav";
+    else if (game.currentStage < 10) path = "Assets/Audio/Music/return0 late level music.wav";
+    else path = "Assets/Audio/Music/return0 boss music.wav";
+    return FrameArena_Strdup(path);
 }
\ No newline at end of file
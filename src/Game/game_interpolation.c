@@ -0,0 +1,121 @@
+/**
+ * @file game_interpolation.c
+ * @brief Render interpolation between simulation steps
+ *
+ * The simulation runs at a fixed tick rate while frames are drawn as often
+ * as the display allows. To keep movement smooth, the positions of the
+ * player, their gun, the camera and every enemy are remembered at the start
+ * of each step, and while a frame is drawn they are temporarily replaced by
+ * a blend of the previous and the latest step (Time->interpolationAlpha).
+ *
+ * @author Mango
+ * @date 2025-04-15
+ */
+
+#include <game.h>
+#include <stdlib.h>
+
+/**
+ * @brief Positions that moved further than this in one step are drawn without blending
+ *
+ * Catches teleports like level changes and reused enemy slots.
+ */
+#define INTERPOLATION_SNAP_DISTANCE 64.0f
+
+static Vec2 previousPlayerPosition;
+static Vec2 previousGunPosition;
+static Vec2 previousCameraPosition;
+static Vec2* previousEnemyPositions = NULL;
+
+// Simulated positions, put back once the frame is drawn
+static Vec2 simulatedPlayerPosition;
+static Vec2 simulatedGunPosition;
+static Vec2 simulatedCameraPosition;
+static Vec2* simulatedEnemyPositions = NULL;
+static bool interpolationApplied = false;
+
+/**
+ * @brief [Utility] Blends two positions, or returns the latest one if they are too far apart
+ */
+static Vec2 Game_InterpolatePosition(Vec2 previous, Vec2 current, float alpha) {
+    Vec2 difference = Vec2_Subtract(current, previous);
+    if (Vec2_Magnitude(difference) > INTERPOLATION_SNAP_DISTANCE) return current;
+    return Vec2_Add(previous, Vec2_Multiply(difference, alpha));
+}
+
+/**
+ * [PostUpdate] Remembers the positions before a simulation step changes them
+ *
+ * Called at the start of every step in every scene, so positions that stop
+ * changing (e.g. while paused) are drawn still instead of blending forever.
+ */
+void Game_SaveInterpolationState() {
+    if (!previousEnemyPositions && Enemy_Capacity > 0) {
+        previousEnemyPositions = calloc(Enemy_Capacity, sizeof(Vec2));
+        simulatedEnemyPositions = calloc(Enemy_Capacity, sizeof(Vec2));
+    }
+
+    previousPlayerPosition = player.state.position;
+    previousGunPosition = player.state.currentGun.state.position;
+    previousCameraPosition = camera.position;
+    if (!previousEnemyPositions) return;
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        EnemyBucket* bucket = &EnemyBuckets[type];
+        for (int i = 0; i < bucket->count; i++) {
+            int index = bucket->indices[i];
+            previousEnemyPositions[index] = enemies[index].state.position;
+        }
+    }
+}
+
+/**
+ * [Render] Replaces the simulated positions with interpolated ones for drawing
+ *
+ * Must be followed by Game_RestoreInterpolation() once the frame is drawn.
+ */
+void Game_ApplyInterpolation() {
+    if (interpolationApplied) return;
+    float alpha = Time->interpolationAlpha;
+
+    simulatedPlayerPosition = player.state.position;
+    simulatedGunPosition = player.state.currentGun.state.position;
+    simulatedCameraPosition = camera.position;
+    player.state.position = Game_InterpolatePosition(previousPlayerPosition, simulatedPlayerPosition, alpha);
+    player.state.currentGun.state.position = Game_InterpolatePosition(previousGunPosition, simulatedGunPosition, alpha);
+    camera.position = Game_InterpolatePosition(previousCameraPosition, simulatedCameraPosition, alpha);
+
+    if (previousEnemyPositions) {
+        for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+            EnemyBucket* bucket = &EnemyBuckets[type];
+            for (int i = 0; i < bucket->count; i++) {
+                int index = bucket->indices[i];
+                simulatedEnemyPositions[index] = enemies[index].state.position;
+                enemies[index].state.position = Game_InterpolatePosition(
+                    previousEnemyPositions[index], simulatedEnemyPositions[index], alpha
+                );
+            }
+        }
+    }
+    interpolationApplied = true;
+}
+
+/**
+ * [Render] Puts back the simulated positions replaced by Game_ApplyInterpolation()
+ */
+void Game_RestoreInterpolation() {
+    if (!interpolationApplied) return;
+    player.state.position = simulatedPlayerPosition;
+    player.state.currentGun.state.position = simulatedGunPosition;
+    camera.position = simulatedCameraPosition;
+
+    if (simulatedEnemyPositions) {
+        for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+            EnemyBucket* bucket = &EnemyBuckets[type];
+            for (int i = 0; i < bucket->count; i++) {
+                int index = bucket->indices[i];
+                enemies[index].state.position = simulatedEnemyPositions[index];
+            }
+        }
+    }
+    interpolationApplied = false;
+}
@@ -98,8 +98,8 @@ void Particle_RandomMovement(Particle* particle) {
     };
     particle->position.x += velocity.x * Time->deltaTimeSeconds;
     particle->position.y += velocity.y * Time->deltaTimeSeconds;
-    particle->position.x += (rand() % 3 - 1);
-    particle->position.y += (rand() % 3 - 1);
+    particle->position.x += Random_Int(RANDOM_STREAM_PARTICLES, -1, 1);
+    particle->position.y += Random_Int(RANDOM_STREAM_PARTICLES, -1, 1);
 }
 
 /**
@@ -112,6 +112,6 @@ void Particle_RandomMovement(Particle* particle) {
 void Particle_SineMovement(Particle* particle) {
     particle->position.x += particle->direction.x * particle->speed * Time->deltaTimeSeconds;
     particle->position.y += particle->direction.y * particle->speed * Time->deltaTimeSeconds;
-    particle->position.x += sin(particle->timeAlive * RandInt(1, 5)) * Time->deltaTimeSeconds * 10;
-    particle->position.y += cos(particle->timeAlive * RandInt(1, 5)) * Time->deltaTimeSeconds * 10;
+    particle->position.x += sin(particle->timeAlive * Random_Int(RANDOM_STREAM_PARTICLES, 1, 5)) * Time->deltaTimeSeconds * 10;
+    particle->position.y += cos(particle->timeAlive * Random_Int(RANDOM_STREAM_PARTICLES, 1, 5)) * Time->deltaTimeSeconds * 10;
 }
\ No newline at end of file
@@ -18,6 +18,7 @@
 #include <timer.h>
 #include <random.h>
 #include <settings.h>
+#include <profiler.h>
 
 /**
  * @brief [Start] Creates a particle emitter from a preset
@@ -90,9 +91,7 @@ void ParticleEmitter_Update(ParticleEmitter* emitter) {
 
     // Emit particles based on timer
     if (Timer_IsFinished(emitter->emissionTimer)) {
-        for (int i = 0; i < emitter->emissionNumber; i++) {
-            ParticleEmitter_Emit(emitter);
-        }
+        ParticleEmitter_EmitBurst(emitter, emitter->emissionNumber);
         Timer_Start(emitter->emissionTimer);
     }
 }
@@ -126,18 +125,16 @@ void ParticleEmitter_Render(ParticleEmitter* emitter) {
 }
 
 /**
- * @brief [Utility] Emits a single particle and set its properties based on the emitter
- * 
- * Creates a new particle with initial properties derived from the emitter
- * settings plus appropriate randomization.
+ * @brief [Utility] Emits a single particle at a given angle from the emitter's direction
  * 
  * @param emitter A pointer to the particle emitter
+ * @param angle Angle in degrees between the emitter's direction and the particle's
  */
-void ParticleEmitter_Emit(ParticleEmitter* emitter) {
+static void ParticleEmitter_EmitAtAngle(ParticleEmitter* emitter, float angle) {
     if (emitter->readyIndex == emitter->maxParticles) return;
     Particle* particle = &emitter->particles[emitter->readyIndex];
     particle->position = emitter->position;
-    particle->direction = Vec2_RotateDegrees(emitter->direction, RandFloat(-emitter->angleRange / 2, emitter->angleRange / 2));
+    particle->direction = Vec2_RotateDegrees(emitter->direction, angle);
     particle->speed = emitter->particleSpeed;
     particle->alive = true;
     particle->maxLifeTime = emitter->particleLifetime;
@@ -165,6 +162,40 @@ void ParticleEmitter_Emit(ParticleEmitter* emitter) {
     particle->collider->hitbox.y = particle->position.y;
 }
 
+/**
+ * @brief [Utility] Emits a single particle and set its properties based on the emitter
+ * 
+ * Creates a new particle with initial properties derived from the emitter
+ * settings plus appropriate randomization.
+ * 
+ * @param emitter A pointer to the particle emitter
+ */
+void ParticleEmitter_Emit(ParticleEmitter* emitter) {
+    ParticleEmitter_EmitAtAngle(emitter, Random_Float(RANDOM_STREAM_PARTICLES, -emitter->angleRange / 2, emitter->angleRange / 2));
+}
+
+/**
+ * @brief [Utility] Emits several particles from the emitter
+ * 
+ * Draws the random angles PARTICLE_RANDOM_BATCH at a time instead of one
+ * generator call per particle.
+ * 
+ * @param emitter A pointer to the particle emitter
+ * @param count The number of particles to emit
+ */
+void ParticleEmitter_EmitBurst(ParticleEmitter* emitter, int count) {
+    float angles[PARTICLE_RANDOM_BATCH];
+    while (count > 0) {
+        int batch = count < PARTICLE_RANDOM_BATCH ? count : PARTICLE_RANDOM_BATCH;
+        RandomState_FillFloat(Random_GetStream(RANDOM_STREAM_PARTICLES), angles, batch,
+            -emitter->angleRange / 2, emitter->angleRange / 2);
+        for (int i = 0; i < batch; i++) {
+            ParticleEmitter_EmitAtAngle(emitter, angles[i]);
+        }
+        count -= batch;
+    }
+}
+
 /**
  * @brief [Utility] Update the state, movement, color and size of every particles of a particle emitter
  * 
@@ -174,9 +205,11 @@ void ParticleEmitter_Emit(ParticleEmitter* emitter) {
  * @param emitter A pointer to the particle emitter
  */
 void ParticleEmitter_UpdateParticles(ParticleEmitter* emitter) {
+    int updatedCount = 0;
     for (int i = 0; i < emitter->maxParticles; i++) {
         Particle* particle = &emitter->particles[i];
         if (!particle->alive) continue;
+        updatedCount++;
         
         particle->timeAlive += Time->deltaTimeSeconds;
         if (particle->timeAlive >= particle->maxLifeTime) {
@@ -223,6 +256,7 @@ void ParticleEmitter_UpdateParticles(ParticleEmitter* emitter) {
         particle->collider->hitbox.w = particle->size.x;
         particle->collider->hitbox.h = particle->size.y;
     }
+    PROFILER_COUNT(PROFILER_COUNTER_PARTICLES_UPDATED, updatedCount);
 }
 
 /**
@@ -295,9 +329,7 @@ bool ParticleEmitter_ParticlesAlive(ParticleEmitter* emitter) {
  * @param emitter A pointer to the particle emitter
  */
 void ParticleEmitter_ActivateOnce(ParticleEmitter* emitter) {
-    for (int i = 0; i < emitter->emissionNumber; i++) {
-        ParticleEmitter_Emit(emitter);
-    }
+    ParticleEmitter_EmitBurst(emitter, emitter->emissionNumber);
 }
 
 /**
@@ -16,6 +16,8 @@
 #include <string.h>
 #include <app.h>
 #include <time_system.h>
+#include <sprite_atlas.h>
+#include <sprite_batch.h>
 
 /**
  * @brief Creates a new animation from animation data
@@ -32,12 +34,15 @@ Animation* Animation_Create(AnimationData* animData) {
     Animation* animation = malloc(sizeof(Animation));
     if (!animation) return NULL;
 
-    animation->spritesheet = IMG_LoadTexture(app.resources.renderer, animData->spritesheetPath);
-    if (!animation->spritesheet) {
+    // Spritesheets are packed into the sprite atlas, so animations sharing a path share the pixels
+    SpriteRegion region;
+    if (SpriteAtlas_Load(animData->spritesheetPath, &region)) {
         SDL_Log("Failed to load spritesheet: %s", animData->spritesheetPath);
         free(animation);
         return NULL;
     }
+    animation->spritesheet = region.texture;
+    animation->sheetRect = region.rect;
     animation->clips = NULL;
     animation->clipCount = 0;
     animation->frameSize = animData->frameSize;
@@ -111,6 +116,8 @@ void Animation_Update(Animation* animation) {
 /**
  * @brief Destroys an animation and frees its resources
  *
+ * The spritesheet belongs to the sprite atlas and is kept.
+ *
  * @param animation Pointer to the animation to destroy
  */
 void Animation_Destroy(Animation* animation) {
@@ -149,8 +156,8 @@ int Animation_AddClipFromGrid(Animation* animation, const char* name,
     int frameCount = endFrameIndex - startFrameIndex + 1;
     if (startFrameIndex < 0 || endFrameIndex > animation->frameCount) return 1;
     
-    int spritesheetWidth, spritesheetHeight;
-    SDL_QueryTexture(animation->spritesheet, NULL, NULL, &spritesheetWidth, &spritesheetHeight);
+    int spritesheetWidth = animation->sheetRect.w;
+    int spritesheetHeight = animation->sheetRect.h;
     
     AnimationFrame* frames = malloc(frameCount * sizeof(AnimationFrame));
     if (!frames) return 1;
@@ -166,7 +173,10 @@ int Animation_AddClipFromGrid(Animation* animation, const char* name,
                 break;
             }
             int currentIndex = frameIndex - startFrameIndex;
-            frames[currentIndex].position = (Vec2) {x, y};
+            frames[currentIndex].position = (Vec2) {
+                animation->sheetRect.x + x, 
+                animation->sheetRect.y + y
+            };
             frames[currentIndex].size = animation->frameSize;
             frameIndex++;
         }
@@ -266,6 +276,9 @@ void Animation_Resume(Animation* animation) {
 /**
  * @brief Renders the current frame of an animation
  *
+ * Goes through SpriteBatch_Draw(), so frames are batched when the caller
+ * has opened a sprite batch and drawn immediately otherwise.
+ *
  * @param animation The animation to render
  * @param destPosition Position where the animation should be drawn
  * @param destSize Size of the drawn animation
@@ -300,15 +313,15 @@ void Animation_Render(Animation* animation, Vec2 destPosition, Vec2 destSize,
         destSize.y
     };
     
-    // Render the frame with the specified flip
-    SDL_RenderCopyEx(
-        app.resources.renderer,
+    // Render the frame with the specified flip, queued if a sprite batch is open
+    SpriteBatch_Draw(
         animation->spritesheet,
         &srcRect,
         &dstRect,
-        angle,      // No rotation
-        rotationCenter,   // No rotation center (default)
-        flip  // Flip horizontally/vertically if needed
+        angle,
+        rotationCenter,
+        flip,
+        255
     );
 }
 
@@ -0,0 +1,189 @@
+/**
+ * @file asset_archive.c
+ * @brief Memory mapped asset archive
+ *
+ * The whole archive is mapped read only and never copied: files are
+ * SDL_RWFromConstMem() views of the mapping. The index is sorted by path
+ * hash, so a lookup is a binary search followed by a path comparison.
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#include <asset_archive.h>
+#include <asset_archive_format.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const Uint8* archiveData = NULL;
+static size_t archiveSize = 0;
+static const AssetArchiveEntry* archiveEntries = NULL;
+static Uint32 archiveEntryCount = 0;
+
+#ifdef _WIN32
+static HANDLE archiveFile = INVALID_HANDLE_VALUE;
+static HANDLE archiveMapping = NULL;
+#endif
+
+/**
+ * @brief [Utility] Maps a whole file read only
+ *
+ * @param path Path of the file
+ * @return int Status code (0 for success, non-zero for error)
+ */
+static int AssetArchive_Map(const char* path) {
+#ifdef _WIN32
+    archiveFile = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (archiveFile == INVALID_HANDLE_VALUE) return 1;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(archiveFile, &size) || size.QuadPart == 0) {
+        CloseHandle(archiveFile);
+        archiveFile = INVALID_HANDLE_VALUE;
+        return 1;
+    }
+    archiveMapping = CreateFileMappingA(archiveFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (archiveMapping) archiveData = MapViewOfFile(archiveMapping, FILE_MAP_READ, 0, 0, 0);
+    if (!archiveData) {
+        if (archiveMapping) CloseHandle(archiveMapping);
+        CloseHandle(archiveFile);
+        archiveMapping = NULL;
+        archiveFile = INVALID_HANDLE_VALUE;
+        return 1;
+    }
+    archiveSize = (size_t) size.QuadPart;
+#else
+    int file = open(path, O_RDONLY);
+    if (file < 0) return 1;
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size == 0) {
+        close(file);
+        return 1;
+    }
+    void* data = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    // The mapping stays valid once the descriptor is closed
+    close(file);
+    if (data == MAP_FAILED) return 1;
+    archiveData = data;
+    archiveSize = (size_t) info.st_size;
+#endif
+    return 0;
+}
+
+/**
+ * @brief [Utility] Checks that the header and every index entry lie inside the archive
+ *
+ * @return bool True if the archive can be used
+ */
+static bool AssetArchive_Validate() {
+    if (archiveSize < sizeof(AssetArchiveHeader)) return false;
+    const AssetArchiveHeader* header = (const AssetArchiveHeader*) archiveData;
+    if (header->magic != ASSET_ARCHIVE_MAGIC || header->version != ASSET_ARCHIVE_VERSION) return false;
+    if (header->entryCount > (archiveSize - sizeof(AssetArchiveHeader)) / sizeof(AssetArchiveEntry)) return false;
+
+    const AssetArchiveEntry* entries = (const AssetArchiveEntry*) (archiveData + sizeof(AssetArchiveHeader));
+    for (Uint32 i = 0; i < header->entryCount; i++) {
+        const AssetArchiveEntry* entry = &entries[i];
+        if ((Uint64) entry->pathOffset + entry->pathLength > archiveSize) return false;
+        if (entry->offset > archiveSize || entry->size > archiveSize - entry->offset) return false;
+    }
+    archiveEntries = entries;
+    archiveEntryCount = header->entryCount;
+    return true;
+}
+
+/**
+ * [Start] Maps an asset archive and checks its index
+ *
+ * @param path Path of the archive
+ * @return int Status code (0 if the archive is open, non-zero if files come from the disk)
+ */
+int AssetArchive_Open(const char* path) {
+    AssetArchive_Close();
+    if (AssetArchive_Map(path)) {
+        SDL_Log("No asset archive at %s, loading assets from the disk", path);
+        return 1;
+    }
+    if (!AssetArchive_Validate()) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Asset archive %s is invalid or outdated, loading assets from the disk", path);
+        AssetArchive_Close();
+        return 1;
+    }
+    SDL_Log("Asset archive %s: %u files, %.1f MB mapped", path, archiveEntryCount, archiveSize / (1024.0 * 1024.0));
+    return 0;
+}
+
+/**
+ * @brief [Utility] Finds the index entry of a path
+ *
+ * @param path The path
+ * @return const AssetArchiveEntry* The entry, NULL if the archive does not hold the path
+ */
+static const AssetArchiveEntry* AssetArchive_Find(const char* path) {
+    Uint32 length = (Uint32) strlen(path);
+    Uint32 hash = AssetArchive_Hash(path, length);
+
+    // First entry with the hash, then every entry sharing it
+    Uint32 low = 0;
+    Uint32 high = archiveEntryCount;
+    while (low < high) {
+        Uint32 middle = low + (high - low) / 2;
+        if (archiveEntries[middle].hash < hash) low = middle + 1;
+        else high = middle;
+    }
+    for (Uint32 i = low; i < archiveEntryCount && archiveEntries[i].hash == hash; i++) {
+        const AssetArchiveEntry* entry = &archiveEntries[i];
+        if (entry->pathLength == length && memcmp(archiveData + entry->pathOffset, path, length) == 0) return entry;
+    }
+    return NULL;
+}
+
+/**
+ * [Utility] Opens an asset file for reading
+ *
+ * @param path Path of the file, like "Assets/Images/title.png"
+ * @return SDL_RWops* A view of the archive, the file on disk, or NULL if neither exists
+ */
+SDL_RWops* AssetArchive_OpenFile(const char* path) {
+    if (archiveData) {
+        const AssetArchiveEntry* entry = AssetArchive_Find(path);
+        if (entry) return SDL_RWFromConstMem(archiveData + entry->offset, (int) entry->size);
+    }
+    return SDL_RWFromFile(path, "rb");
+}
+
+/**
+ * [Utility] Checks whether files are served from an archive
+ *
+ * @return bool True if an archive is open
+ */
+bool AssetArchive_IsOpen() {
+    return archiveData != NULL;
+}
+
+/**
+ * [Quit] Unmaps the archive
+ */
+void AssetArchive_Close() {
+    if (!archiveData) return;
+#ifdef _WIN32
+    UnmapViewOfFile(archiveData);
+    CloseHandle(archiveMapping);
+    CloseHandle(archiveFile);
+    archiveMapping = NULL;
+    archiveFile = INVALID_HANDLE_VALUE;
+#else
+    munmap((void*) archiveData, archiveSize);
+#endif
+    archiveData = NULL;
+    archiveSize = 0;
+    archiveEntries = NULL;
+    archiveEntryCount = 0;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file asset_loader.c
+ * @brief Worker pool that decodes the startup assets
+ *
+ * Workers take the next job with an atomic counter, so no lock is needed:
+ * each job is written by the one worker that claimed it, and the main
+ * thread only reads the results after joining them.
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#include <asset_loader.h>
+#include <assets.h>
+#include <asset_archive.h>
+#include <app.h>
+#include <string.h>
+#include <stdlib.h>
+
+/**
+ * @brief Kinds of assets the loader decodes
+ */
+typedef enum AssetJobType {
+    ASSET_JOB_IMAGE,    /**< Decoded to an RGBA32 surface */
+    ASSET_JOB_SOUND     /**< Decoded to a Mix_Chunk */
+} AssetJobType;
+
+/**
+ * @brief One asset to decode
+ */
+typedef struct AssetJob {
+    AssetJobType type;      /**< What to decode */
+    char* path;             /**< File to decode */
+    SDL_Surface* surface;   /**< Result of an image job */
+    Mix_Chunk* chunk;       /**< Result of a sound job */
+    Mix_Chunk** soundOut;   /**< Where the sound goes once the run is over */
+} AssetJob;
+
+static AssetJob loaderJobs[ASSET_LOADER_MAX_JOBS];
+static int loaderJobCount = 0;
+static SDL_atomic_t loaderNextJob;
+static SDL_atomic_t loaderFinishedJobs;
+
+/**
+ * @brief [Utility] Adds a job to the queue
+ *
+ * @return AssetJob* The job, NULL if the queue is full
+ */
+static AssetJob* AssetLoader_AddJob(AssetJobType type, const char* path) {
+    if (loaderJobCount >= ASSET_LOADER_MAX_JOBS) {
+        SDL_Log("Asset loader queue full, %s will load when used", path);
+        return NULL;
+    }
+    AssetJob* job = &loaderJobs[loaderJobCount++];
+    *job = (AssetJob) {type, strdup(path), NULL, NULL, NULL};
+    return job;
+}
+
+/**
+ * [Start] Queues an image to decode
+ *
+ * @param path Path of the image file
+ */
+void AssetLoader_QueueImage(const char* path) {
+    for (int i = 0; i < loaderJobCount; i++) {
+        if (loaderJobs[i].type == ASSET_JOB_IMAGE && strcmp(loaderJobs[i].path, path) == 0) return;
+    }
+    AssetLoader_AddJob(ASSET_JOB_IMAGE, path);
+}
+
+/**
+ * [Start] Queues a sound to decode
+ *
+ * @param path Path of the sound file
+ * @param out Receives the sound
+ */
+void AssetLoader_QueueSound(const char* path, Mix_Chunk** out) {
+    AssetJob* job = AssetLoader_AddJob(ASSET_JOB_SOUND, path);
+    if (job) job->soundOut = out;
+}
+
+/**
+ * @brief [Utility] Decodes one asset, runs on the workers
+ *
+ * @param job The job to run
+ */
+static void AssetLoader_Decode(AssetJob* job) {
+    if (job->type == ASSET_JOB_SOUND) {
+        job->chunk = Mix_LoadWAV_RW(AssetArchive_OpenFile(job->path), 1);
+        return;
+    }
+    SDL_Surface* loaded = IMG_Load_RW(AssetArchive_OpenFile(job->path), 1);
+    if (!loaded) return;
+    job->surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+}
+
+/**
+ * @brief [Utility] Worker thread entry, decodes jobs until none are left
+ *
+ * @param data Unused
+ * @return int Always 0
+ */
+static int AssetLoader_Worker(void* data) {
+    (void) data;
+    for (;;) {
+        int index = SDL_AtomicAdd(&loaderNextJob, 1);
+        if (index >= loaderJobCount) return 0;
+        AssetLoader_Decode(&loaderJobs[index]);
+        SDL_AtomicAdd(&loaderFinishedJobs, 1);
+    }
+}
+
+/**
+ * @brief [Render] Draws the loading progress bar
+ *
+ * @param finished Jobs done so far
+ */
+static void AssetLoader_RenderProgress(int finished) {
+    SDL_Renderer* renderer = app.resources.renderer;
+    int width = app.config.screen_width / 2;
+    SDL_Rect outline = {(app.config.screen_width - width) / 2, app.config.screen_height / 2 - 4, width, 8};
+    SDL_Rect fill = {outline.x + 2, outline.y + 2, (outline.w - 4) * finished / loaderJobCount, outline.h - 4};
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    SDL_RenderDrawRect(renderer, &outline);
+    SDL_RenderFillRect(renderer, &fill);
+    SDL_RenderPresent(renderer);
+}
+
+/**
+ * [Start] Decodes every queued asset on the worker threads
+ *
+ * The main thread keeps the window responsive and draws the progress
+ * while waiting. If no thread can be started it decodes the assets
+ * itself. Decoded images are handed to the asset cache and sounds are
+ * written where they were asked for.
+ *
+ * @return int Number of assets that failed to load
+ */
+int AssetLoader_Run() {
+    if (loaderJobCount == 0) return 0;
+    Uint64 start = SDL_GetPerformanceCounter();
+    SDL_AtomicSet(&loaderNextJob, 0);
+    SDL_AtomicSet(&loaderFinishedJobs, 0);
+
+    int threadCount = SDL_GetCPUCount();
+    if (threadCount > ASSET_LOADER_MAX_THREADS) threadCount = ASSET_LOADER_MAX_THREADS;
+    if (threadCount > loaderJobCount) threadCount = loaderJobCount;
+    SDL_Thread* threads[ASSET_LOADER_MAX_THREADS];
+    int started = 0;
+    for (int i = 0; i < threadCount; i++) {
+        threads[started] = SDL_CreateThread(AssetLoader_Worker, "AssetLoader", NULL);
+        if (threads[started]) started++;
+    }
+
+    if (started == 0) {
+        SDL_Log("Asset loader: no worker thread could be started, decoding on the main thread");
+        AssetLoader_Worker(NULL);
+    }
+    bool showProgress = app.config.headlessFrames == 0;
+    while (SDL_AtomicGet(&loaderFinishedJobs) < loaderJobCount) {
+        SDL_PumpEvents();
+        if (showProgress) AssetLoader_RenderProgress(SDL_AtomicGet(&loaderFinishedJobs));
+        SDL_Delay(showProgress ? 16 : 1);
+    }
+    for (int i = 0; i < started; i++) SDL_WaitThread(threads[i], NULL);
+
+    int failed = 0;
+    for (int i = 0; i < loaderJobCount; i++) {
+        AssetJob* job = &loaderJobs[i];
+        if (job->type == ASSET_JOB_IMAGE && job->surface) {
+            Assets_AddSurface(job->path, job->surface);
+        } else if (job->type == ASSET_JOB_SOUND && job->chunk) {
+            *job->soundOut = job->chunk;
+        } else {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to decode %s", job->path);
+            failed++;
+        }
+        free(job->path);
+    }
+
+    SDL_Log("Asset loader: %d assets decoded in %.1f ms on %d threads", loaderJobCount - failed,
+        (double) (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency(), started > 0 ? started : 1);
+    loaderJobCount = 0;
+    return failed;
+}
@@ -0,0 +1,269 @@
+/**
+ * @file assets.c
+ * @brief Path keyed texture cache
+ *
+ * Entries live in a fixed array and are found through an open addressing
+ * hash index of their path (FNV-1a, linear probing). An entry whose last
+ * reference is released keeps its path and slot, so loading the same path
+ * again reuses it and the index never needs deletions.
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#include <assets.h>
+#include <asset_archive.h>
+#include <SDL_image.h>
+#include <app.h>
+#include <profiler.h>
+#include <string.h>
+#include <stdlib.h>
+
+/**
+ * @brief A path the cache knows about
+ */
+typedef struct AssetEntry {
+    char* path;             /**< Path the texture was loaded from */
+    Uint32 hash;            /**< Hash of the path */
+    SDL_Texture* texture;   /**< The texture, NULL once every reference was released */
+    SDL_Surface* surface;   /**< Pixels decoded ahead of time and not uploaded yet */
+    int references;         /**< Live references taken by Assets_LoadTexture() */
+    size_t bytes;           /**< Estimated memory of the texture */
+} AssetEntry;
+
+static AssetEntry assetEntries[ASSETS_MAX_TEXTURES];
+static int assetEntryCount = 0;
+// Index + 1 of the entry using each bucket, 0 for an empty bucket
+static int assetBuckets[ASSETS_HASH_BUCKETS];
+static size_t assetTextureBytes = 0;
+
+/**
+ * @brief [Utility] Hashes a path with FNV-1a
+ *
+ * @param path The path
+ * @return Uint32 The hash
+ */
+static Uint32 Assets_Hash(const char* path) {
+    Uint32 hash = 2166136261u;
+    for (const char* c = path; *c; c++) {
+        hash ^= (Uint8) *c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief [Utility] Finds the bucket of a path
+ *
+ * @param path The path
+ * @param hash Hash of the path
+ * @return int The bucket holding the path, or the empty bucket it would go in
+ */
+static int Assets_FindBucket(const char* path, Uint32 hash) {
+    int bucket = hash & (ASSETS_HASH_BUCKETS - 1);
+    while (assetBuckets[bucket]) {
+        AssetEntry* entry = &assetEntries[assetBuckets[bucket] - 1];
+        if (entry->hash == hash && strcmp(entry->path, path) == 0) return bucket;
+        bucket = (bucket + 1) & (ASSETS_HASH_BUCKETS - 1);
+    }
+    return bucket;
+}
+
+/**
+ * @brief [Utility] Gets the entry of a path, adding an empty one if there is none
+ *
+ * @param path The path
+ * @return AssetEntry* The entry, NULL if the cache is full
+ */
+static AssetEntry* Assets_GetEntry(const char* path) {
+    Uint32 hash = Assets_Hash(path);
+    int bucket = Assets_FindBucket(path, hash);
+    if (assetBuckets[bucket]) return &assetEntries[assetBuckets[bucket] - 1];
+
+    if (assetEntryCount >= ASSETS_MAX_TEXTURES) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Asset cache full (%d textures), cannot add %s", ASSETS_MAX_TEXTURES, path);
+        return NULL;
+    }
+    AssetEntry* entry = &assetEntries[assetEntryCount++];
+    *entry = (AssetEntry) {0};
+    entry->path = strdup(path);
+    entry->hash = hash;
+    assetBuckets[bucket] = assetEntryCount;
+    return entry;
+}
+
+/**
+ * @brief [Utility] Creates the texture of an entry and accounts for its memory
+ *
+ * Uploads the surface decoded ahead of time if there is one, otherwise
+ * loads the file.
+ *
+ * @param entry The entry, its path must be set
+ */
+static void Assets_LoadEntry(AssetEntry* entry) {
+    if (entry->surface) {
+        entry->texture = SDL_CreateTextureFromSurface(app.resources.renderer, entry->surface);
+        SDL_FreeSurface(entry->surface);
+        entry->surface = NULL;
+    } else {
+        entry->texture = IMG_LoadTexture_RW(app.resources.renderer, AssetArchive_OpenFile(entry->path), 1);
+    }
+    if (!entry->texture) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load texture %s: %s", entry->path, IMG_GetError());
+        return;
+    }
+    PROFILER_COUNT(PROFILER_COUNTER_TEXTURES_CREATED, 1);
+
+    Uint32 format;
+    int w, h;
+    SDL_QueryTexture(entry->texture, &format, NULL, &w, &h);
+    int bytesPerPixel = SDL_BYTESPERPIXEL(format) > 0 ? SDL_BYTESPERPIXEL(format) : 4;
+    entry->bytes = (size_t) w * h * bytesPerPixel;
+    assetTextureBytes += entry->bytes;
+}
+
+/**
+ * [Utility] Loads a texture, or returns the one already loaded from the same path
+ *
+ * @param path Path of the image file
+ * @return SDL_Texture* The texture, NULL if it could not be loaded
+ */
+SDL_Texture* Assets_LoadTexture(const char* path) {
+    if (!path) return NULL;
+    AssetEntry* entry = Assets_GetEntry(path);
+    if (!entry) return NULL;
+
+    if (!entry->texture) Assets_LoadEntry(entry);
+    if (!entry->texture) return NULL;
+    entry->references++;
+    return entry->texture;
+}
+
+/**
+ * [Utility] Gets the decoded pixels of an image, in SDL_PIXELFORMAT_RGBA32
+ *
+ * @param path Path of the image file
+ * @return SDL_Surface* The surface, owned by the caller, NULL if it could not be loaded
+ */
+SDL_Surface* Assets_LoadSurface(const char* path) {
+    if (!path) return NULL;
+    Uint32 hash = Assets_Hash(path);
+    int bucket = Assets_FindBucket(path, hash);
+    if (assetBuckets[bucket]) {
+        AssetEntry* entry = &assetEntries[assetBuckets[bucket] - 1];
+        if (entry->surface) {
+            SDL_Surface* surface = entry->surface;
+            entry->surface = NULL;
+            return surface;
+        }
+    }
+
+    SDL_Surface* loaded = IMG_Load_RW(AssetArchive_OpenFile(path), 1);
+    if (!loaded) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to load image %s: %s", path, IMG_GetError());
+        return NULL;
+    }
+    SDL_Surface* surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (!surface) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to convert image %s: %s", path, SDL_GetError());
+    }
+    return surface;
+}
+
+/**
+ * [Utility] Keeps a decoded image until its path is loaded
+ *
+ * @param path Path the image was decoded from
+ * @param surface The decoded image, the cache takes ownership
+ */
+void Assets_AddSurface(const char* path, SDL_Surface* surface) {
+    AssetEntry* entry = Assets_GetEntry(path);
+    if (!entry || entry->texture || entry->surface) {
+        SDL_FreeSurface(surface);
+        return;
+    }
+    entry->surface = surface;
+}
+
+/**
+ * [Start] Frees the decoded images nothing asked for
+ *
+ * Called once startup is over, so images that were decoded but are not
+ * used do not keep their pixels around.
+ */
+void Assets_FreeSurfaces() {
+    int unused = 0;
+    for (int i = 0; i < assetEntryCount; i++) {
+        if (!assetEntries[i].surface) continue;
+        SDL_FreeSurface(assetEntries[i].surface);
+        assetEntries[i].surface = NULL;
+        unused++;
+    }
+    if (unused > 0) SDL_Log("Assets: %d decoded images were not used", unused);
+}
+
+/**
+ * [Utility] Gives back a reference to a cached texture
+ *
+ * @param texture The texture, NULL is ignored
+ */
+void Assets_ReleaseTexture(SDL_Texture* texture) {
+    if (!texture) return;
+    for (int i = 0; i < assetEntryCount; i++) {
+        AssetEntry* entry = &assetEntries[i];
+        if (entry->texture != texture) continue;
+        if (--entry->references > 0) return;
+        SDL_DestroyTexture(entry->texture);
+        entry->texture = NULL;
+        entry->references = 0;
+        assetTextureBytes -= entry->bytes;
+        entry->bytes = 0;
+        return;
+    }
+    SDL_Log("Assets_ReleaseTexture: texture was not loaded through the asset cache");
+}
+
+/**
+ * [Utility] Gets the memory held by the cached textures
+ *
+ * @return size_t Bytes of pixel data
+ */
+size_t Assets_GetTextureMemory() {
+    return assetTextureBytes;
+}
+
+/**
+ * [Utility] Logs how many textures are cached and the memory they use
+ */
+void Assets_LogUsage() {
+    int loaded = 0;
+    int references = 0;
+    for (int i = 0; i < assetEntryCount; i++) {
+        if (!assetEntries[i].texture) continue;
+        loaded++;
+        references += assetEntries[i].references;
+    }
+    SDL_Log("Assets: %d textures (%d references), %.1f KB", loaded, references, assetTextureBytes / 1024.0);
+}
+
+/**
+ * [Quit] Destroys every cached texture and forgets every path
+ *
+ * Textures still referenced at this point were never released by the
+ * module that loaded them, they are logged before being destroyed.
+ */
+void Assets_Destroy() {
+    for (int i = 0; i < assetEntryCount; i++) {
+        if (assetEntries[i].references > 0) {
+            SDL_Log("Assets: %s still has %d references", assetEntries[i].path, assetEntries[i].references);
+        }
+        if (assetEntries[i].texture) SDL_DestroyTexture(assetEntries[i].texture);
+        if (assetEntries[i].surface) SDL_FreeSurface(assetEntries[i].surface);
+        free(assetEntries[i].path);
+    }
+    memset(assetEntries, 0, sizeof(assetEntries));
+    memset(assetBuckets, 0, sizeof(assetBuckets));
+    assetEntryCount = 0;
+    assetTextureBytes = 0;
+}
@@ -1,6 +1,178 @@
 #include <app.h>
 #include <circle.h>
 #include <math.h>
+#include <profiler.h>
+
+/**
+ * @brief A cached shape texture and the parameters it was made with
+ */
+typedef struct ShapeCacheEntry {
+    int radius;             /**< Radius of the shape in pixels */
+    int thickness;          /**< Outline thickness, 0 for a filled shape */
+    bool half;              /**< Whether this is a half circle facing right */
+    SDL_Color color;        /**< Color of the shape */
+    SDL_Texture* texture;   /**< The rasterized shape */
+} ShapeCacheEntry;
+
+static ShapeCacheEntry shapeCache[SHAPE_CACHE_SIZE];
+static int shapeCacheCount = 0;
+
+/**
+ * @brief [Utility] Fills pixels from..to (inclusive) of a row, clipped to the texture
+ */
+static void FillSpan(Uint32* row, int from, int to, int width, Uint32 pixel) {
+    if (from < 0) from = 0;
+    if (to > width - 1) to = width - 1;
+    for (int x = from; x <= to; x++) row[x] = pixel;
+}
+
+/**
+ * @brief [Utility] Rasterizes a circle, ring or half of one into a new streaming texture
+ * 
+ * Each row is filled as at most two spans written straight into the locked
+ * pixels: the outer circle minus the inner hole for rings, clipped to the
+ * half plane in front of the direction for half circles. The pixels kept are
+ * the same as the old per-point version: dx^2 + dy^2 <= radius^2, outside
+ * (radius - thickness)^2 for outlines, and dot(direction, (dx, dy)) > 0 for halves.
+ * 
+ * @param radius Radius of the shape
+ * @param direction Normalized facing direction for half circles, Vec2_Zero for a full circle
+ * @param color Color of the shape
+ * @param thickness Outline thickness, 0 for a filled shape
+ * @return SDL_Texture* The new texture, owned by the caller
+ */
+static SDL_Texture* RasterizeCircleTexture(int radius, Vec2 direction, SDL_Color color, int thickness) {
+    if (radius <= 0) return NULL;
+    int diameter = radius * 2;
+    SDL_Texture* texture = SDL_CreateTexture(
+        app.resources.renderer,
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_TEXTUREACCESS_STREAMING,
+        diameter,
+        diameter
+    );
+    if (!texture) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create circle texture: %s", SDL_GetError());
+        return NULL;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    PROFILER_COUNT(PROFILER_COUNTER_TEXTURES_CREATED, 1);
+
+    void* pixels;
+    int pitch;
+    if (SDL_LockTexture(texture, NULL, &pixels, &pitch) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to lock circle texture: %s", SDL_GetError());
+        SDL_DestroyTexture(texture);
+        return NULL;
+    }
+
+    Uint32 pixel = ((Uint32) color.a << 24) | ((Uint32) color.r << 16) | ((Uint32) color.g << 8) | color.b;
+    bool half = direction.x != 0 || direction.y != 0;
+    int innerRadius = radius - thickness;
+
+    for (int y = 0; y < diameter; y++) {
+        Uint32* row = (Uint32*) ((Uint8*) pixels + y * pitch);
+        SDL_memset(row, 0, diameter * sizeof(Uint32));
+
+        int dy = y - radius;
+        int outerSquared = radius * radius - dy * dy;
+        if (outerSquared < 0) continue;
+        int outer = (int) floorf(sqrtf(outerSquared));
+        int left = radius - outer;
+        int right = radius + outer;
+
+        // Half circles: keep x where direction.x * (x - radius) + direction.y * dy > 0
+        if (half) {
+            float c = direction.y * dy;
+            if (direction.x > 0) {
+                int minX = (int) floorf(radius - c / direction.x) + 1;
+                if (minX > left) left = minX;
+            } else if (direction.x < 0) {
+                int maxX = (int) ceilf(radius - c / direction.x) - 1;
+                if (maxX < right) right = maxX;
+            } else if (c <= 0) {
+                continue;
+            }
+        }
+        if (left > right) continue;
+
+        int innerSquared = innerRadius * innerRadius - dy * dy;
+        if (thickness <= 0 || innerRadius < 0 || innerSquared < 0) {
+            FillSpan(row, left, right, diameter, pixel);
+            continue;
+        }
+        // Rings skip the hole in the middle of the row
+        int inner = (int) floorf(sqrtf(innerSquared));
+        FillSpan(row, left, SDL_min(right, radius - inner - 1), diameter, pixel);
+        FillSpan(row, SDL_max(left, radius + inner + 1), right, diameter, pixel);
+    }
+
+    SDL_UnlockTexture(texture);
+    return texture;
+}
+
+/**
+ * @brief [Utility] Looks up or creates a cached shape texture
+ */
+static SDL_Texture* GetCachedShapeTexture(int radius, SDL_Color color, int thickness, bool half) {
+    for (int i = 0; i < shapeCacheCount; i++) {
+        ShapeCacheEntry* entry = &shapeCache[i];
+        if (entry->radius == radius && entry->thickness == thickness && entry->half == half &&
+            entry->color.r == color.r && entry->color.g == color.g &&
+            entry->color.b == color.b && entry->color.a == color.a) {
+            return entry->texture;
+        }
+    }
+    if (shapeCacheCount >= SHAPE_CACHE_SIZE) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Shape cache is full, raise SHAPE_CACHE_SIZE");
+        return NULL;
+    }
+
+    SDL_Texture* texture = RasterizeCircleTexture(radius, half ? (Vec2) {1, 0} : Vec2_Zero, color, thickness);
+    if (!texture) return NULL;
+    shapeCache[shapeCacheCount++] = (ShapeCacheEntry) {radius, thickness, half, color, texture};
+    return texture;
+}
+
+/**
+ * @brief [Utility] Returns a shared circle texture, creating it on first use
+ * 
+ * The texture is owned by the cache and must not be destroyed. Set its
+ * alpha mod before every draw, since other users share it.
+ * 
+ * @param radius Radius of the circle
+ * @param color Color of the circle
+ * @param thickness Outline thickness, 0 for a filled circle
+ * @return SDL_Texture* The cached texture, NULL on failure
+ */
+SDL_Texture* GetCachedCircleTexture(int radius, SDL_Color color, int thickness) {
+    return GetCachedShapeTexture(radius, color, thickness, false);
+}
+
+/**
+ * @brief [Utility] Returns a shared half circle texture facing right
+ * 
+ * Point it in any direction by rotating it with SDL_RenderCopyEx.
+ * The texture is owned by the cache and must not be destroyed.
+ * 
+ * @param radius Radius of the half circle
+ * @param color Color of the half circle
+ * @param thickness Outline thickness, 0 for a filled half circle
+ * @return SDL_Texture* The cached texture, NULL on failure
+ */
+SDL_Texture* GetCachedHalfCircleTexture(int radius, SDL_Color color, int thickness) {
+    return GetCachedShapeTexture(radius, color, thickness, true);
+}
+
+/**
+ * @brief [Quit] Destroys every cached shape texture
+ */
+void ClearShapeCache() {
+    for (int i = 0; i < shapeCacheCount; i++) {
+        SDL_DestroyTexture(shapeCache[i].texture);
+    }
+    shapeCacheCount = 0;
+}
 
 void DrawFilledCircle(Vec2 center, int radius, SDL_Color color)
 {
@@ -71,55 +243,7 @@ void DrawFilledHalfCircle(Vec2 center, int radius, Vec2 direction, SDL_Color col
  * @return SDL_Texture* containing the half-circle
  */
 SDL_Texture* CreateHalfCircleTexture(int radius, Vec2 direction, SDL_Color color) {
-    // Normalize direction
-    direction = Vec2_Normalize(direction);
-    
-    // Create a texture with dimensions to fit the circle
-    int diameter = radius * 2;
-    SDL_Texture* texture = SDL_CreateTexture(
-        app.resources.renderer,
-        SDL_PIXELFORMAT_RGBA8888,
-        SDL_TEXTUREACCESS_TARGET,
-        diameter, 
-        diameter
-    );
-    
-    // Enable alpha blending on the texture
-    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-    
-    // Set the render target to our texture
-    SDL_SetRenderTarget(app.resources.renderer, texture);
-    
-    // Clear the texture with transparent background
-    SDL_SetRenderDrawColor(app.resources.renderer, 0, 0, 0, 0);
-    SDL_RenderClear(app.resources.renderer);
-    
-    // Set draw color for the half-circle
-    SDL_SetRenderDrawColor(app.resources.renderer, color.r, color.g, color.b, color.a);
-    
-    // Draw the filled half-circle
-    for (int y = 0; y < diameter; y++) {
-        for (int x = 0; x < diameter; x++) {
-            int dx = x - radius;
-            int dy = y - radius;
-            
-            // Check if within circle radius
-            if ((dx*dx + dy*dy) <= (radius * radius)) {
-                // Create vector from center to this point
-                Vec2 pointVector = {(float)dx, (float)dy};
-                
-                // Check if in the correct half
-                if (Vec2_Dot(direction, pointVector) > 0) {
-                    SDL_RenderDrawPoint(app.resources.renderer, x, y);
-                }
-            }
-        }
-    }
-    
-    // Reset render target back to the default
-    SDL_SetRenderTarget(app.resources.renderer, app.resources.screenTexture);
-    
-    return texture;
+    return RasterizeCircleTexture(radius, Vec2_Normalize(direction), color, 0);
 }
 
 
@@ -133,78 +257,7 @@ SDL_Texture* CreateHalfCircleTexture(int radius, Vec2 direction, SDL_Color color
  * @return SDL_Texture* containing the half-circle outline
  */
 SDL_Texture* CreateHalfCircleOutlineTexture(int radius, Vec2 direction, SDL_Color color, int thickness) {
-    // Normalize direction
-    direction = Vec2_Normalize(direction);
-    
-    // Create a texture with dimensions to fit the circle
-    int diameter = radius * 2;
-    SDL_Texture* texture = SDL_CreateTexture(
-        app.resources.renderer,
-        SDL_PIXELFORMAT_RGBA8888,
-        SDL_TEXTUREACCESS_TARGET,
-        diameter, 
-        diameter
-    );
-    
-    // Enable alpha blending
-    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-    
-    // Set the render target to our texture
-    SDL_SetRenderTarget(app.resources.renderer, texture);
-    
-    // Clear with transparent background
-    SDL_SetRenderDrawColor(app.resources.renderer, 0, 0, 0, 0);
-    SDL_RenderClear(app.resources.renderer);
-    
-    // Draw multiple circles for thickness
-    SDL_SetRenderDrawColor(app.resources.renderer, color.r, color.g, color.b, color.a);
-    
-    for (int t = 0; t < thickness; t++) {
-        int r = radius - t;
-        if (r < 0) break;
-        
-        int x = 0;
-        int y = r;
-        int d = 3 - 2 * r;
-        
-        while (y >= x) {
-            // For each point, check if it's in the half-circle facing the direction
-            Vec2 points[8] = {
-                {(float)x, (float)-y},  // 1st octant
-                {(float)y, (float)-x},  // 2nd octant
-                {(float)y, (float)x},   // 3rd octant
-                {(float)x, (float)y},   // 4th octant
-                {(float)-x, (float)y},  // 5th octant
-                {(float)-y, (float)x},  // 6th octant
-                {(float)-y, (float)-x}, // 7th octant
-                {(float)-x, (float)-y}  // 8th octant
-            };
-            
-            // Check and draw each point if it's in the half facing the direction
-            for (int i = 0; i < 8; i++) {
-                if (Vec2_Dot(direction, points[i]) > 0) {
-                    SDL_RenderDrawPoint(app.resources.renderer, 
-                                       radius + points[i].x, 
-                                       radius + points[i].y);
-                }
-            }
-            
-            // Update using Bresenham's algorithm
-            if (d < 0) {
-                d = d + 4 * x + 6;
-            } else {
-                d = d + 4 * (x - y) + 10;
-                y--;
-            }
-            x++;
-        }
-    }
-    
-    
-    // Reset render target
-    SDL_SetRenderTarget(app.resources.renderer, app.resources.screenTexture);
-    
-    return texture;
+    return RasterizeCircleTexture(radius, Vec2_Normalize(direction), color, thickness);
 }
 bool IsRectOverlappingCircle(SDL_Rect rect, Vec2 circleCenter, float radius) {
     // Find closest point on rectangle to circle center
@@ -221,56 +274,7 @@ bool IsRectOverlappingCircle(SDL_Rect rect, Vec2 circleCenter, float radius) {
 }
 
 SDL_Texture* CreateCircleTexture(int radius, SDL_Color color) {
-    // Create a texture with dimensions to fit the circle
-    int diameter = radius * 2;
-    SDL_Texture* texture = SDL_CreateTexture(
-        app.resources.renderer,
-        SDL_PIXELFORMAT_RGBA8888,
-        SDL_TEXTUREACCESS_TARGET,
-        diameter, 
-        diameter
-    );
-    
-    if (!texture) {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create circle texture: %s", SDL_GetError());
-        return NULL;
-    }
-    
-    // Enable alpha blending on the texture
-    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-    
-    // Store current render target
-    SDL_Texture* prevTarget = SDL_GetRenderTarget(app.resources.renderer);
-    
-    // Set the render target to our texture
-    if (SDL_SetRenderTarget(app.resources.renderer, texture) < 0) {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to set render target: %s", SDL_GetError());
-        SDL_DestroyTexture(texture);
-        return NULL;
-    }
-    
-    // Clear the texture with transparent background
-    SDL_SetRenderDrawColor(app.resources.renderer, 0, 0, 0, 0);
-    SDL_RenderClear(app.resources.renderer);
-    
-    // Set draw color for the circle
-    SDL_SetRenderDrawColor(app.resources.renderer, color.r, color.g, color.b, color.a);
-    
-    // Draw the filled circle
-    for (int y = 0; y < diameter; y++) {
-        for (int x = 0; x < diameter; x++) {
-            int dx = radius - x;
-            int dy = radius - y;
-            if ((dx*dx + dy*dy) <= (radius * radius)) {
-                SDL_RenderDrawPoint(app.resources.renderer, x, y);
-            }
-        }
-    }
-    
-    // Reset render target back to the previous target
-    SDL_SetRenderTarget(app.resources.renderer, prevTarget);
-    
-    return texture;
+    return RasterizeCircleTexture(radius, Vec2_Zero, color, 0);
 }
 
 /**
@@ -317,60 +321,5 @@ void DrawCircleOutline(Vec2 center, int radius, SDL_Color color) {
  * @return SDL_Texture* containing the circle outline
  */
 SDL_Texture* CreateCircleOutlineTexture(int radius, SDL_Color color, int thickness) {
-    // Create a texture with dimensions to fit the circle
-    int diameter = radius * 2;
-    SDL_Texture* texture = SDL_CreateTexture(
-        app.resources.renderer,
-        SDL_PIXELFORMAT_RGBA8888,
-        SDL_TEXTUREACCESS_TARGET,
-        diameter, 
-        diameter
-    );
-    
-    // Enable alpha blending
-    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-    
-    // Set the render target to our texture
-    SDL_SetRenderTarget(app.resources.renderer, texture);
-    
-    // Clear with transparent background
-    SDL_SetRenderDrawColor(app.resources.renderer, 0, 0, 0, 0);
-    SDL_RenderClear(app.resources.renderer);
-    
-    // Draw multiple circles for thickness
-    SDL_SetRenderDrawColor(app.resources.renderer, color.r, color.g, color.b, color.a);
-    
-    for (int t = 0; t < thickness; t++) {
-        int r = radius - t;
-        if (r < 0) break;
-        
-        int x = 0;
-        int y = r;
-        int d = 3 - 2 * r;
-        
-        while (y >= x) {
-            // Draw the 8 octant points
-            SDL_RenderDrawPoint(app.resources.renderer, radius + x, radius - y);
-            SDL_RenderDrawPoint(app.resources.renderer, radius + y, radius - x);
-            SDL_RenderDrawPoint(app.resources.renderer, radius + y, radius + x);
-            SDL_RenderDrawPoint(app.resources.renderer, radius + x, radius + y);
-            SDL_RenderDrawPoint(app.resources.renderer, radius - x, radius + y);
-            SDL_RenderDrawPoint(app.resources.renderer, radius - y, radius + x);
-            SDL_RenderDrawPoint(app.resources.renderer, radius - y, radius - x);
-            SDL_RenderDrawPoint(app.resources.renderer, radius - x, radius - y);
-            
-            if (d < 0) {
-                d = d + 4 * x + 6;
-            } else {
-                d = d + 4 * (x - y) + 10;
-                y--;
-            }
-            x++;
-        }
-    }
-    
-    // Reset render target
-    SDL_SetRenderTarget(app.resources.renderer, app.resources.screenTexture);
-    
-    return texture;
+    return RasterizeCircleTexture(radius, Vec2_Zero, color, thickness);
 }
\ No newline at end of file
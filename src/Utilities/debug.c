@@ -19,6 +19,9 @@
 #include <maps.h>
 #include <player.h>
 #include <settings.h>
+#include <profiler.h>
+#include <frame_arena.h>
+#include <assets.h>
 
 /** Color constants for hitbox visualization */
 #define PLAYER_HITBOX_COLOR 0, 255, 0, 255
@@ -156,7 +159,8 @@ void Debug_RenderFPSCount() {
  * @brief [Render] Renders a counter of frame spikes (frames exceeding target time)
  * 
  * Tracks and displays the number of frames that took longer than
- * the target frame time (frames with fps below 30).
+ * the target frame time (frames with fps below 30), and how many spike
+ * captures were written (see --spike-capture in profiler.h).
  */
 void Debug_RenderSpikeCount() {
     if (!app.config.debug) return;
@@ -170,8 +174,8 @@ void Debug_RenderSpikeCount() {
     if (Time->deltaTimeSeconds > 1.0 / targetFPS) spikeCount++;
 
     // Format text
-    char text[20];
-    sprintf(text, "Spike frames: %d", spikeCount);
+    char text[48];
+    sprintf(text, "Spike frames: %d, captured: %d", spikeCount, Profiler_GetSpikeCaptureCount());
 
     if (!spikeTextElement) {
         // Create text element if it doesn't exist 
@@ -212,15 +216,17 @@ void Debug_RenderCurrentChunk() {
     float targetFPS = 30;
     if (Time->deltaTimeSeconds > 1.0 / targetFPS) spikeCount++;
 
-    char text[20];
+    char text[48];
 
-    Vec2 chunkPosition = Chunk_GetCurrentChunk(player.state.position)->position;
+    EnvironmentChunk* currentChunk = Chunk_GetCurrentChunk(player.state.position);
+    if (!currentChunk) return;
+    Vec2 chunkPosition = currentChunk->position;
     int ChunkX = (int) chunkPosition.x;
     int ChunkY = (int) chunkPosition.y;
 
     int nextChunkX = testMap.mainPath[0].x;
     int nextChunkY = testMap.mainPath[0].y;
-    for(int i = 0; i < MAP_LENGTH - 1; i++) {
+    for(int i = 0; i < testMap.mainPathLength; i++) {
         if (testMap.mainPath[i].x == ChunkX && testMap.mainPath[i].y == ChunkY) {
             nextChunkX = testMap.mainPath[i+1].x;
             nextChunkY = testMap.mainPath[i+1].y;
@@ -251,4 +257,50 @@ void Debug_RenderCurrentChunk() {
 
     UI_UpdateText(spikeTextElement);
     UI_RenderText(spikeTextElement);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief [Render] Renders the allocations made during the last frame
+ * 
+ * Shows the heap allocations counted by the profiler at the tracked
+ * runtime sites, how much of the frame arena was used, and the memory held
+ * by the texture cache (see assets.h).
+ */
+void Debug_RenderAllocationCount() {
+    if (!app.config.debug) return;
+    // The UIElement struct stored in a static variable for reuse
+    static UIElement* allocationTextElement = NULL;
+
+    FrameArenaStats arena = FrameArena_GetLastFrameStats();
+    char text[128];
+    snprintf(text, sizeof(text), "Allocations: %d heap, %d arena (%d/%d KB, peak %d KB), textures %d KB",
+        Profiler_GetLastFrameCounter(PROFILER_COUNTER_HEAP_ALLOCATIONS),
+        arena.allocations,
+        (int) (arena.bytesUsed / 1024),
+        FRAME_ARENA_CAPACITY / 1024,
+        (int) (arena.peakBytesUsed / 1024),
+        (int) (Assets_GetTextureMemory() / 1024));
+
+    if (!allocationTextElement) {
+        // Create text element if it doesn't exist 
+        SDL_Color textColor = {255, 255, 255, 255};
+        SDL_Rect renderRect = {10, 50, 0, 0};
+        float textScale = 1;
+        UI_TextAlignment alignment = UI_TEXT_ALIGN_LEFT;
+
+        allocationTextElement = UI_CreateText(
+            text, 
+            renderRect, 
+            textColor, 
+            textScale, 
+            alignment, 
+            app.resources.textFont
+        );
+    } else {
+        // Update text if it does exist.
+        UI_ChangeText(allocationTextElement, text);
+    }
+
+    UI_UpdateText(allocationTextElement);
+    UI_RenderText(allocationTextElement);
+}
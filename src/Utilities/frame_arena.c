@@ -0,0 +1,104 @@
+/**
+ * @file frame_arena.c
+ * @brief Frame arena implementation
+ *
+ * Overflow allocations get a small header linking them together, so the
+ * reset can free them without knowing their sizes.
+ *
+ * @author Mango
+ * @date 2025-04-17
+ */
+
+#include <frame_arena.h>
+#include <profiler.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Header in front of an allocation that did not fit in the block
+ */
+typedef struct FrameArenaOverflow {
+    struct FrameArenaOverflow* next;
+    // Keeps the memory after the header aligned
+    char padding[FRAME_ARENA_ALIGNMENT - sizeof(struct FrameArenaOverflow*)];
+} FrameArenaOverflow;
+
+static _Alignas(FRAME_ARENA_ALIGNMENT) Uint8 arenaBlock[FRAME_ARENA_CAPACITY];
+static size_t arenaOffset = 0;
+static FrameArenaOverflow* arenaOverflow = NULL;
+static FrameArenaStats arenaStats = {0};
+static FrameArenaStats arenaLastFrameStats = {0};
+
+/**
+ * [Utility] Allocates memory that stays valid until the next FrameArena_Reset()
+ *
+ * @param size Number of bytes
+ * @return void* The memory, or NULL if size is 0 or the fallback malloc failed
+ */
+void* FrameArena_Alloc(size_t size) {
+    if (size == 0) return NULL;
+    arenaStats.allocations++;
+    PROFILER_COUNT(PROFILER_COUNTER_ARENA_ALLOCATIONS, 1);
+
+    size_t aligned = (size + FRAME_ARENA_ALIGNMENT - 1) & ~(size_t) (FRAME_ARENA_ALIGNMENT - 1);
+    if (aligned <= FRAME_ARENA_CAPACITY - arenaOffset) {
+        void* memory = arenaBlock + arenaOffset;
+        arenaOffset += aligned;
+        arenaStats.bytesUsed = arenaOffset;
+        return memory;
+    }
+
+    if (arenaStats.overflowAllocations == 0) {
+        SDL_Log("Frame arena full (%d bytes), falling back to malloc for this frame", FRAME_ARENA_CAPACITY);
+    }
+    arenaStats.overflowAllocations++;
+    PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 1);
+    FrameArenaOverflow* overflow = malloc(sizeof(FrameArenaOverflow) + size);
+    if (!overflow) return NULL;
+    overflow->next = arenaOverflow;
+    arenaOverflow = overflow;
+    return overflow + 1;
+}
+
+/**
+ * [Utility] Copies a string into the arena
+ *
+ * @param text The string to copy
+ * @return char* The copy, valid until the next FrameArena_Reset()
+ */
+char* FrameArena_Strdup(const char* text) {
+    size_t length = strlen(text) + 1;
+    char* copy = FrameArena_Alloc(length);
+    if (copy) memcpy(copy, text, length);
+    return copy;
+}
+
+/**
+ * [PreUpdate] Gives back everything allocated since the last reset
+ *
+ * Called once at the start of every frame, so memory from the arena can be
+ * used anywhere in the update and render routines of the same frame.
+ */
+void FrameArena_Reset() {
+    while (arenaOverflow) {
+        FrameArenaOverflow* next = arenaOverflow->next;
+        free(arenaOverflow);
+        arenaOverflow = next;
+    }
+    if (arenaStats.bytesUsed > arenaStats.peakBytesUsed) arenaStats.peakBytesUsed = arenaStats.bytesUsed;
+    arenaLastFrameStats = arenaStats;
+
+    size_t peak = arenaStats.peakBytesUsed;
+    arenaStats = (FrameArenaStats) {0};
+    arenaStats.peakBytesUsed = peak;
+    arenaOffset = 0;
+}
+
+/**
+ * [Utility] Returns how the arena was used during the previous frame
+ *
+ * @return FrameArenaStats The usage recorded by the last FrameArena_Reset()
+ */
+FrameArenaStats FrameArena_GetLastFrameStats() {
+    return arenaLastFrameStats;
+}
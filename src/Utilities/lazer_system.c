@@ -56,42 +56,95 @@ void Lazer_Update(Lazer* lazer) {
     lazer->endPosition = currentPosition;
 }
 
+static SDL_Vertex beamVertices[LAZER_BATCH_MAX_BEAMS * 8];
+static int beamIndices[LAZER_BATCH_MAX_BEAMS * 12];
+static int beamQuadCount = 0;
+
 /**
- * @brief Renders a lazer with a glowing effect
+ * @brief [Utility] Queues a quad covering a segment
  *
- * @param lazer Pointer to the Lazer struct containing its properties
+ * @param start Start of the segment on screen
+ * @param end End of the segment on screen
+ * @param halfWidth Distance from the segment to the long edges
+ * @param extend How far the quad reaches past both ends
+ * @param color Color of the quad
  */
-void Lazer_Render(Lazer* lazer) {
-    // Draw the red outer glow
-    SDL_SetRenderDrawColor(app.resources.renderer, 255, 0, 0, 255);
-    Vec2 lazerStart = Camera_WorldVecToScreen(lazer->startPosition);
-    Vec2 lazerEnd = Camera_WorldVecToScreen(lazer->endPosition);
-
-    for (int dx = -lazer->width; dx <= lazer->width; dx++) {
-        for (int dy = -lazer->width; dy <= lazer->width; dy++) {
-            if ((dx == 0 && dy == 0) || (dx * dx + dy * dy > lazer->width * lazer->width)) {
-                continue;
-            }
+static void Lazer_QueueQuad(Vec2 start, Vec2 end, float halfWidth, float extend, SDL_Color color) {
+    Vec2 direction = Vec2_Subtract(end, start);
+    float length = Vec2_Magnitude(direction);
+    direction = length > 0.001f ? Vec2_Divide(direction, length) : (Vec2) {1, 0};
+    Vec2 normal = {-direction.y * halfWidth, direction.x * halfWidth};
+    Vec2 back = Vec2_Subtract(start, Vec2_Multiply(direction, extend));
+    Vec2 front = Vec2_Add(end, Vec2_Multiply(direction, extend));
 
-            SDL_RenderDrawLine(
-                app.resources.renderer,
-                lazerStart.x + dx,
-                lazerStart.y + dy,
-                lazerEnd.x + dx,
-                lazerEnd.y + dy
-            );
-        }
+    Vec2 corners[4] = {
+        Vec2_Add(back, normal),
+        Vec2_Add(front, normal),
+        Vec2_Subtract(front, normal),
+        Vec2_Subtract(back, normal)
+    };
+    int first = beamQuadCount * 4;
+    for (int i = 0; i < 4; i++) {
+        beamVertices[first + i] = (SDL_Vertex) {{corners[i].x, corners[i].y}, color, {0, 0}};
+    }
+    int* indices = &beamIndices[beamQuadCount * 6];
+    indices[0] = first;
+    indices[1] = first + 1;
+    indices[2] = first + 2;
+    indices[3] = first + 2;
+    indices[4] = first + 3;
+    indices[5] = first;
+    beamQuadCount++;
+}
+
+/**
+ * @brief Queues a beam with a red glow and a white core
+ *
+ * The glow is a quad reaching width pixels around the beam, covering the
+ * same pixels as the old disc of offset lines, and the core is a one pixel
+ * wide quad on top of it. A width of 0 only draws a thin red line.
+ *
+ * @param startPosition The starting position of the beam in world coordinates
+ * @param endPosition The ending position of the beam in world coordinates
+ * @param width The glow radius around the core
+ */
+void Lazer_DrawBeam(Vec2 startPosition, Vec2 endPosition, int width) {
+    if (width < 0) return;
+    if (beamQuadCount + 2 > LAZER_BATCH_MAX_BEAMS * 2) Lazer_FlushBeams();
+
+    // Offset to pixel centers, where SDL_RenderDrawLine used to draw
+    Vec2 start = Vec2_Add(Camera_WorldVecToScreen(startPosition), (Vec2) {0.5f, 0.5f});
+    Vec2 end = Vec2_Add(Camera_WorldVecToScreen(endPosition), (Vec2) {0.5f, 0.5f});
+
+    if (width == 0) {
+        Lazer_QueueQuad(start, end, 0.5f, 0.5f, (SDL_Color) {255, 0, 0, 255});
+        return;
     }
+    Lazer_QueueQuad(start, end, width + 0.5f, width, (SDL_Color) {255, 0, 0, 255});
+    Lazer_QueueQuad(start, end, 0.5f, 0.5f, (SDL_Color) {255, 255, 255, 255});
+}
 
-    // Draw the white center line
-    if (lazer->width > 0) {
-        SDL_SetRenderDrawColor(app.resources.renderer, 255, 255, 255, 255);
+/**
+ * @brief Draws every queued beam in one SDL_RenderGeometry call
+ */
+void Lazer_FlushBeams() {
+    if (beamQuadCount == 0) return;
+    if (SDL_RenderGeometry(
+            app.resources.renderer,
+            NULL,
+            beamVertices, beamQuadCount * 4,
+            beamIndices, beamQuadCount * 6
+        ) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to draw lazer beams: %s", SDL_GetError());
     }
-    SDL_RenderDrawLine(
-        app.resources.renderer,
-        lazerStart.x,
-        lazerStart.y,
-        lazerEnd.x,
-        lazerEnd.y
-    );
-}
\ No newline at end of file
+    beamQuadCount = 0;
+}
+
+/**
+ * @brief Queues a lazer for the next Lazer_FlushBeams()
+ *
+ * @param lazer Pointer to the Lazer struct containing its properties
+ */
+void Lazer_Render(Lazer* lazer) {
+    Lazer_DrawBeam(lazer->startPosition, lazer->endPosition, lazer->width);
+}
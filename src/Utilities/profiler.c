@@ -0,0 +1,470 @@
+/**
+ * @file profiler.c
+ * @brief Scoped profiler implementation
+ *
+ * Frames live in a fixed ring buffer, each with its own array of samples,
+ * so recording a zone never allocates. Open zones are tracked on a small
+ * stack of sample indices; zones that did not fit in the frame push -1 so
+ * their matching end is still consumed.
+ *
+ * @author Mango
+ * @date 2025-04-16
+ */
+
+#include <profiler.h>
+#include <app.h>
+#include <UI_text.h>
+#include <colliders.h>
+#include <enemy.h>
+#include <stdio.h>
+#include <string.h>
+
+/** Overlay layout, the graph sits in the bottom-left corner of the screen */
+#define PROFILER_OVERLAY_MARGIN 10
+#define PROFILER_OVERLAY_HEIGHT 64
+#define PROFILER_OVERLAY_MAX_MS 33.3f
+#define PROFILER_OVERLAY_TARGET_MS (1000.0f / 60.0f)
+#define PROFILER_OVERLAY_TOP_ZONES 5
+#define PROFILER_OVERLAY_AVERAGE_FRAMES 60
+/** Frames between refreshes of the zone list, so the text stays readable */
+#define PROFILER_OVERLAY_REFRESH_FRAMES 30
+/** Distinct zone names tracked when averaging */
+#define PROFILER_MAX_ZONE_NAMES 64
+
+/**
+ * @brief One recorded zone
+ */
+typedef struct ProfilerSample {
+    const char* name;   /**< Name the zone was opened with */
+    int depth;          /**< Number of zones open around it */
+    Uint64 start;       /**< Performance counter when the zone opened */
+    Uint64 end;         /**< Performance counter when the zone closed */
+} ProfilerSample;
+
+/**
+ * @brief One frame of the ring buffer
+ */
+typedef struct ProfilerFrame {
+    Uint64 start;           /**< Performance counter when the frame began */
+    Uint64 end;             /**< Performance counter when the frame ended */
+    bool complete;          /**< Recorded and closed, so safe to read */
+    int sampleCount;        /**< Number of samples used */
+    int counters[PROFILER_COUNTER_COUNT]; /**< What happened during the frame */
+    ProfilerSample samples[PROFILER_MAX_SAMPLES_PER_FRAME];
+} ProfilerFrame;
+
+/**
+ * @brief Total time of one zone name over several frames
+ */
+typedef struct ProfilerZoneTotal {
+    const char* name;
+    Uint64 ticks;
+} ProfilerZoneTotal;
+
+/** Names of the counters in trace files, in ProfilerCounter order */
+static const char* profilerCounterNames[PROFILER_COUNTER_COUNT] = {
+    "colliders",
+    "enemies",
+    "particlesUpdated",
+    "texturesCreated",
+    "textsRasterized",
+    "heapAllocations",
+    "arenaAllocations"
+};
+
+static ProfilerFrame profilerFrames[PROFILER_HISTORY_FRAMES];
+static int profilerFrameIndex = -1;
+static bool profilerRecording = false;
+static int profilerZoneStack[PROFILER_MAX_DEPTH];
+static int profilerDepth = 0;
+
+static int spikeCaptureCount = 0;
+static int spikeCooldownFrames = 0;
+
+static int Profiler_WriteTrace(const char* path, int frameWindow);
+static void Profiler_CaptureSpike(ProfilerFrame* frame);
+
+/**
+ * @brief [Utility] Returns a buffered frame counting back from the newest one
+ *
+ * @param age 0 for the current frame, 1 for the one before, ...
+ * @return ProfilerFrame* The frame, or NULL if it was not recorded
+ */
+static ProfilerFrame* Profiler_GetFrame(int age) {
+    if (profilerFrameIndex < 0 || age >= PROFILER_HISTORY_FRAMES) return NULL;
+    int index = (profilerFrameIndex - age) % PROFILER_HISTORY_FRAMES;
+    if (index < 0) index += PROFILER_HISTORY_FRAMES;
+    ProfilerFrame* frame = &profilerFrames[index];
+    return frame->complete ? frame : NULL;
+}
+
+/**
+ * [PreUpdate] Starts a new frame in the ring buffer
+ *
+ * Zones still open from the previous frame are discarded.
+ *
+ * @param record Whether zones of this frame should be recorded
+ */
+void Profiler_BeginFrame(bool record) {
+    profilerFrameIndex = (profilerFrameIndex + 1) % PROFILER_HISTORY_FRAMES;
+    ProfilerFrame* frame = &profilerFrames[profilerFrameIndex];
+    frame->complete = false;
+    frame->sampleCount = 0;
+    SDL_memset(frame->counters, 0, sizeof(frame->counters));
+    frame->start = SDL_GetPerformanceCounter();
+    frame->end = frame->start;
+    profilerRecording = record;
+    profilerDepth = 0;
+}
+
+/**
+ * [Render] Closes the current frame
+ */
+void Profiler_EndFrame() {
+    if (profilerFrameIndex < 0) return;
+    ProfilerFrame* frame = &profilerFrames[profilerFrameIndex];
+    frame->end = SDL_GetPerformanceCounter();
+    // Zones left open end with the frame
+    while (profilerDepth > 0) {
+        profilerDepth--;
+        if (profilerDepth < PROFILER_MAX_DEPTH && profilerZoneStack[profilerDepth] >= 0) {
+            frame->samples[profilerZoneStack[profilerDepth]].end = frame->end;
+        }
+    }
+    frame->complete = profilerRecording;
+    profilerRecording = false;
+    if (!frame->complete) return;
+
+    frame->counters[PROFILER_COUNTER_COLLIDERS] = ColliderCount;
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        frame->counters[PROFILER_COUNTER_ENEMIES] += EnemyBuckets[type].count;
+    }
+
+    if (spikeCooldownFrames > 0) spikeCooldownFrames--;
+    double frameMs = (frame->end - frame->start) * 1000.0 / SDL_GetPerformanceFrequency();
+    if (app.config.spikeThresholdMs > 0 && frameMs > app.config.spikeThresholdMs && spikeCooldownFrames == 0) {
+        Profiler_CaptureSpike(frame);
+    }
+}
+
+/**
+ * [Utility] Opens a zone
+ *
+ * @param name Name of the zone, must stay valid while the frame is in the buffer
+ */
+void Profiler_BeginZone(const char* name) {
+    if (!profilerRecording) return;
+    ProfilerFrame* frame = &profilerFrames[profilerFrameIndex];
+    int sampleIndex = -1;
+    if (profilerDepth < PROFILER_MAX_DEPTH && frame->sampleCount < PROFILER_MAX_SAMPLES_PER_FRAME) {
+        sampleIndex = frame->sampleCount++;
+        ProfilerSample* sample = &frame->samples[sampleIndex];
+        sample->name = name ? name : "(unnamed)";
+        sample->depth = profilerDepth;
+        sample->start = SDL_GetPerformanceCounter();
+        sample->end = sample->start;
+    }
+    if (profilerDepth < PROFILER_MAX_DEPTH) profilerZoneStack[profilerDepth] = sampleIndex;
+    profilerDepth++;
+}
+
+/**
+ * [Utility] Closes the most recently opened zone
+ */
+void Profiler_EndZone() {
+    if (!profilerRecording || profilerDepth == 0) return;
+    profilerDepth--;
+    if (profilerDepth >= PROFILER_MAX_DEPTH) return;
+    int sampleIndex = profilerZoneStack[profilerDepth];
+    if (sampleIndex < 0) return;
+    profilerFrames[profilerFrameIndex].samples[sampleIndex].end = SDL_GetPerformanceCounter();
+}
+
+/**
+ * [Utility] Adds to a counter of the current frame
+ *
+ * @param counter The counter to add to
+ * @param amount The amount to add
+ */
+void Profiler_Count(ProfilerCounter counter, int amount) {
+    if (!profilerRecording) return;
+    profilerFrames[profilerFrameIndex].counters[counter] += amount;
+}
+
+/**
+ * [Utility] Returns a counter of the last closed frame
+ *
+ * @param counter The counter to read
+ * @return int Its value, 0 if that frame was not recorded
+ */
+int Profiler_GetLastFrameCounter(ProfilerCounter counter) {
+    // The newest frame is still open between Profiler_BeginFrame() and Profiler_EndFrame()
+    ProfilerFrame* frame = Profiler_GetFrame(profilerRecording ? 1 : 0);
+    return frame ? frame->counters[counter] : 0;
+}
+
+/**
+ * [Utility] Returns the number of spike captures written so far
+ *
+ * @return int Number of files written
+ */
+int Profiler_GetSpikeCaptureCount() {
+    return spikeCaptureCount;
+}
+
+/**
+ * @brief [Utility] Writes the frames leading up to a slow frame to a new file
+ *
+ * @param frame The slow frame, already closed
+ */
+static void Profiler_CaptureSpike(ProfilerFrame* frame) {
+    if (spikeCaptureCount >= PROFILER_SPIKE_MAX_CAPTURES) return;
+    spikeCooldownFrames = PROFILER_SPIKE_COOLDOWN_FRAMES;
+
+    char path[64];
+    snprintf(path, sizeof(path), PROFILER_SPIKE_PATH_FORMAT, spikeCaptureCount + 1);
+    if (Profiler_WriteTrace(path, PROFILER_SPIKE_WINDOW_FRAMES)) return;
+    spikeCaptureCount++;
+
+    // Name the slowest nested zone so the log alone hints at the cause
+    double msPerTick = 1000.0 / SDL_GetPerformanceFrequency();
+    ProfilerSample* slowest = NULL;
+    for (int i = 0; i < frame->sampleCount; i++) {
+        ProfilerSample* sample = &frame->samples[i];
+        if (sample->depth == 0) continue;
+        if (!slowest || sample->end - sample->start > slowest->end - slowest->start) slowest = sample;
+    }
+    SDL_Log("Frame spike of %.2f ms written to %s, slowest zone %s (%.2f ms)",
+        (frame->end - frame->start) * msPerTick, path,
+        slowest ? slowest->name : "none",
+        slowest ? (slowest->end - slowest->start) * msPerTick : 0.0);
+}
+
+/**
+ * @brief [Utility] Picks a stable color for a zone name
+ */
+static SDL_Color Profiler_ZoneColor(const char* name) {
+    static const SDL_Color palette[] = {
+        {231, 76, 60, 255}, {46, 204, 113, 255}, {52, 152, 219, 255}, {241, 196, 15, 255},
+        {155, 89, 182, 255}, {26, 188, 156, 255}, {230, 126, 34, 255}, {236, 240, 241, 255}
+    };
+    Uint32 hash = 2166136261u;
+    for (const char* c = name; c && *c; c++) hash = (hash ^ (Uint8) *c) * 16777619u;
+    return palette[hash % SDL_arraysize(palette)];
+}
+
+/**
+ * @brief [Utility] Adds up the time of every nested zone name over the last frames
+ *
+ * Top level zones are left out, they already make up the bars of the graph.
+ *
+ * @param totals Where to store the totals, sorted from most to least expensive
+ * @param frameCount Set to the number of frames that were added up
+ * @return int Number of distinct zone names
+ */
+static int Profiler_SumZones(ProfilerZoneTotal totals[PROFILER_MAX_ZONE_NAMES], int* frameCount) {
+    int count = 0;
+    *frameCount = 0;
+    // The current frame is still open, start from the one before
+    for (int age = 1; age <= PROFILER_OVERLAY_AVERAGE_FRAMES; age++) {
+        ProfilerFrame* frame = Profiler_GetFrame(age);
+        if (!frame) continue;
+        (*frameCount)++;
+        for (int i = 0; i < frame->sampleCount; i++) {
+            ProfilerSample* sample = &frame->samples[i];
+            if (sample->depth == 0) continue;
+            int slot = 0;
+            while (slot < count && totals[slot].name != sample->name && strcmp(totals[slot].name, sample->name) != 0) slot++;
+            if (slot == count) {
+                if (count == PROFILER_MAX_ZONE_NAMES) continue;
+                totals[count++] = (ProfilerZoneTotal) {sample->name, 0};
+            }
+            totals[slot].ticks += sample->end - sample->start;
+        }
+    }
+    // Few names, a simple insertion sort is enough
+    for (int i = 1; i < count; i++) {
+        ProfilerZoneTotal total = totals[i];
+        int j = i - 1;
+        while (j >= 0 && totals[j].ticks < total.ticks) {
+            totals[j + 1] = totals[j];
+            j--;
+        }
+        totals[j + 1] = total;
+    }
+    return count;
+}
+
+/**
+ * @brief [Render] Lists the most expensive zones next to the graph
+ */
+static void Profiler_RenderTopZones(int x, int y) {
+    static UIElement* zoneTexts[PROFILER_OVERLAY_TOP_ZONES] = {NULL};
+    static int framesUntilRefresh = 0;
+
+    if (--framesUntilRefresh <= 0) {
+        framesUntilRefresh = PROFILER_OVERLAY_REFRESH_FRAMES;
+        ProfilerZoneTotal totals[PROFILER_MAX_ZONE_NAMES];
+        int frameCount;
+        int count = Profiler_SumZones(totals, &frameCount);
+        double msPerTick = 1000.0 / SDL_GetPerformanceFrequency();
+
+        for (int i = 0; i < PROFILER_OVERLAY_TOP_ZONES; i++) {
+            char text[96] = " ";
+            if (i < count && frameCount > 0) {
+                snprintf(text, sizeof(text), "%.2f ms %s", totals[i].ticks * msPerTick / frameCount, totals[i].name);
+            }
+            if (!zoneTexts[i]) {
+                SDL_Rect renderRect = {x, y + i * 10, 0, 0};
+                zoneTexts[i] = UI_CreateText(
+                    text,
+                    renderRect,
+                    (SDL_Color) {255, 255, 255, 255},
+                    1,
+                    UI_TEXT_ALIGN_LEFT,
+                    app.resources.textFont
+                );
+            } else {
+                UI_ChangeText(zoneTexts[i], text);
+            }
+        }
+    }
+
+    for (int i = 0; i < PROFILER_OVERLAY_TOP_ZONES; i++) {
+        if (!zoneTexts[i]) continue;
+        UI_UpdateText(zoneTexts[i]);
+        UI_RenderText(zoneTexts[i]);
+    }
+}
+
+/**
+ * [Render] Draws the frame time bar graph and the most expensive zones
+ *
+ * Every buffered frame is a 1 pixel wide bar, split into its top level
+ * zones. The line marks the time budget of a 60 fps frame.
+ */
+void Profiler_RenderOverlay() {
+    if (!app.config.debug) return;
+    SDL_Renderer* renderer = app.resources.renderer;
+    double msPerTick = 1000.0 / SDL_GetPerformanceFrequency();
+    float pixelsPerMs = PROFILER_OVERLAY_HEIGHT / PROFILER_OVERLAY_MAX_MS;
+    int left = PROFILER_OVERLAY_MARGIN;
+    int bottom = app.config.screen_height - PROFILER_OVERLAY_MARGIN;
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 150);
+    SDL_RenderFillRect(renderer, &(SDL_Rect) {left, bottom - PROFILER_OVERLAY_HEIGHT, PROFILER_HISTORY_FRAMES, PROFILER_OVERLAY_HEIGHT});
+
+    // Oldest frame on the left
+    for (int age = 1; age < PROFILER_HISTORY_FRAMES; age++) {
+        ProfilerFrame* frame = Profiler_GetFrame(age);
+        if (!frame) continue;
+        int x = left + PROFILER_HISTORY_FRAMES - age;
+
+        int frameHeight = SDL_min((int) ((frame->end - frame->start) * msPerTick * pixelsPerMs), PROFILER_OVERLAY_HEIGHT);
+        SDL_SetRenderDrawColor(renderer, 90, 90, 90, 255);
+        SDL_RenderDrawLine(renderer, x, bottom - 1, x, bottom - frameHeight);
+
+        int stacked = 0;
+        for (int i = 0; i < frame->sampleCount && stacked < PROFILER_OVERLAY_HEIGHT; i++) {
+            ProfilerSample* sample = &frame->samples[i];
+            if (sample->depth != 0) continue;
+            int height = (int) ((sample->end - sample->start) * msPerTick * pixelsPerMs);
+            height = SDL_min(height, PROFILER_OVERLAY_HEIGHT - stacked);
+            if (height <= 0) continue;
+            SDL_Color color = Profiler_ZoneColor(sample->name);
+            SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, 255);
+            SDL_RenderDrawLine(renderer, x, bottom - 1 - stacked, x, bottom - stacked - height);
+            stacked += height;
+        }
+    }
+
+    int targetY = bottom - (int) (PROFILER_OVERLAY_TARGET_MS * pixelsPerMs);
+    SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
+    SDL_RenderDrawLine(renderer, left, targetY, left + PROFILER_HISTORY_FRAMES - 1, targetY);
+
+    Profiler_RenderTopZones(left + PROFILER_HISTORY_FRAMES + 8, bottom - PROFILER_OVERLAY_HEIGHT);
+}
+
+/**
+ * @brief [Utility] Writes a string as a JSON string literal
+ */
+static void Profiler_WriteJSONString(FILE* file, const char* text) {
+    fputc('"', file);
+    for (const char* c = text ? text : ""; *c; c++) {
+        if (*c == '"' || *c == '\\') fputc('\\', file);
+        if ((unsigned char) *c < 0x20) continue;
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+/**
+ * @brief [Utility] Writes the newest buffered frames as Chrome trace-event JSON
+ *
+ * Frames become "Frame" events and zones nest inside them as complete
+ * ("X") events, with times in microseconds from the oldest frame. The
+ * counters of each frame are added as a counter ("C") event.
+ *
+ * @param path The file to write
+ * @param frameWindow Number of frames to write, counting back from the newest one
+ * @return int Status code (0 for success, non-zero for error)
+ */
+static int Profiler_WriteTrace(const char* path, int frameWindow) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to open trace file %s", path);
+        return 1;
+    }
+    double usPerTick = 1000000.0 / SDL_GetPerformanceFrequency();
+
+    // Oldest frame first, so its start can be the origin
+    Uint64 origin = 0;
+    bool first = true;
+    int frameCount = 0;
+    fprintf(file, "{\"traceEvents\":[\n");
+    for (int age = SDL_min(frameWindow, PROFILER_HISTORY_FRAMES) - 1; age >= 0; age--) {
+        ProfilerFrame* frame = Profiler_GetFrame(age);
+        if (!frame) continue;
+        if (first) origin = frame->start;
+
+        fprintf(file, "%s{\"name\":\"Frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+            first ? "" : ",\n",
+            (frame->start - origin) * usPerTick,
+            (frame->end - frame->start) * usPerTick);
+        first = false;
+        for (int i = 0; i < frame->sampleCount; i++) {
+            ProfilerSample* sample = &frame->samples[i];
+            fprintf(file, ",\n{\"name\":");
+            Profiler_WriteJSONString(file, sample->name);
+            fprintf(file, ",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+                (sample->start - origin) * usPerTick,
+                (sample->end - sample->start) * usPerTick);
+        }
+        fprintf(file, ",\n{\"name\":\"Counters\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{",
+            (frame->start - origin) * usPerTick);
+        for (int counter = 0; counter < PROFILER_COUNTER_COUNT; counter++) {
+            fprintf(file, "%s\"%s\":%d", counter ? "," : "", profilerCounterNames[counter], frame->counters[counter]);
+        }
+        fprintf(file, "}}");
+        frameCount++;
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    if (fclose(file) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to write trace file %s", path);
+        return 1;
+    }
+    SDL_Log("Wrote %d profiled frames to %s", frameCount, path);
+    return 0;
+}
+
+/**
+ * [Utility] Writes every buffered frame as Chrome trace-event JSON
+ *
+ * @param path The file to write
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int Profiler_ExportTrace(const char* path) {
+    return Profiler_WriteTrace(path, PROFILER_HISTORY_FRAMES);
+}
@@ -0,0 +1,311 @@
+/**
+ * @file replay.c
+ * @brief Input recording and headless replay of play sessions
+ *
+ * A session is reproduced from its input alone: the seed fixes every
+ * random number, and replaying the recorded frame times makes the time
+ * system run the same fixed steps in the same frames. See replay.h for
+ * the file format.
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#include <replay.h>
+#include <app.h>
+#include <input.h>
+#include <string.h>
+
+/**
+ * @brief State of the recording or replay in progress
+ */
+typedef struct ReplaySession {
+    SDL_RWops* file;        /**< The open file, NULL when not recording or replaying */
+    bool playing;           /**< True when replaying, false when recording */
+    Uint32 frames;          /**< Frames written or read so far */
+    Sint64 frameCountOffset;    /**< Where the frame count is in the header */
+    ReplayEvent events[REPLAY_MAX_EVENTS_PER_FRAME];  /**< Input events of the current frame */
+    int eventCount;         /**< Number of events of the current frame */
+    Vec2 mousePosition;     /**< Mouse position of the current frame, when replaying */
+} ReplaySession;
+
+static ReplaySession replay = {0};
+
+/**
+ * @brief [Utility] Writes a double as its bit pattern
+ */
+static void Replay_WriteDouble(SDL_RWops* file, double value) {
+    Uint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    SDL_WriteLE64(file, bits);
+}
+
+/**
+ * @brief [Utility] Writes a float as its bit pattern
+ */
+static void Replay_WriteFloat(SDL_RWops* file, float value) {
+    Uint32 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    SDL_WriteLE32(file, bits);
+}
+
+/**
+ * @brief [Utility] Reads a double written by Replay_WriteDouble()
+ */
+static double Replay_ReadDouble(SDL_RWops* file) {
+    Uint64 bits = SDL_ReadLE64(file);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief [Utility] Reads a float written by Replay_WriteFloat()
+ */
+static float Replay_ReadFloat(SDL_RWops* file) {
+    Uint32 bits = SDL_ReadLE32(file);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief [Start] Creates a recording file and writes its header
+ *
+ * Sessions without --seed get one picked here, so that every run of the
+ * session uses it and the replay can too.
+ *
+ * @param path The file to create
+ * @return int Status code (0 for success, non-zero for error)
+ */
+static int Replay_StartRecording(const char* path) {
+    replay.file = SDL_RWFromFile(path, "wb");
+    if (!replay.file) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create recording %s: %s", path, SDL_GetError());
+        return 1;
+    }
+    if (app.config.seed <= 0) app.config.seed = (int) (SDL_GetPerformanceCounter() % 1000000) + 1;
+    if (app.config.tickRate <= 0) app.config.tickRate = TIME_DEFAULT_TICK_RATE;
+
+    SDL_WriteLE32(replay.file, REPLAY_MAGIC);
+    SDL_WriteLE16(replay.file, REPLAY_VERSION);
+    SDL_WriteLE16(replay.file, (Uint16) app.config.tickRate);
+    SDL_WriteLE32(replay.file, (Uint32) app.config.seed);
+    replay.frameCountOffset = SDL_RWtell(replay.file);
+    SDL_WriteLE32(replay.file, 0);
+    SDL_WriteLE16(replay.file, ACTION_COUNT);
+    for (int i = 0; i < ACTION_COUNT; i++) SDL_WriteLE16(replay.file, (Uint16) Input_GetBinding(i));
+
+    SDL_Log("Recording input to %s (seed %d, %d ticks per second)", path, app.config.seed, app.config.tickRate);
+    return 0;
+}
+
+/**
+ * @brief [Start] Opens a recording, and sets the app up to replay it
+ *
+ * @param path The recording to open
+ * @return int Status code (0 for success, non-zero for error)
+ */
+static int Replay_StartPlayback(const char* path) {
+    replay.file = SDL_RWFromFile(path, "rb");
+    if (!replay.file) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to open recording %s: %s", path, SDL_GetError());
+        return 1;
+    }
+    Uint32 magic = SDL_ReadLE32(replay.file);
+    Uint16 version = SDL_ReadLE16(replay.file);
+    if (magic != REPLAY_MAGIC || version != REPLAY_VERSION) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s is not a version %d recording", path, REPLAY_VERSION);
+        return 1;
+    }
+    app.config.tickRate = SDL_ReadLE16(replay.file);
+    app.config.seed = (int) SDL_ReadLE32(replay.file);
+    Uint32 frameCount = SDL_ReadLE32(replay.file);
+    if (frameCount == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Recording %s is empty or was not closed properly", path);
+        return 1;
+    }
+    // The session's bindings, so the recorded keys trigger the same actions
+    int bindingCount = SDL_ReadLE16(replay.file);
+    for (int i = 0; i < bindingCount; i++) {
+        Uint16 scancode = SDL_ReadLE16(replay.file);
+        if (i < ACTION_COUNT) Input_SetBinding(i, scancode);
+    }
+
+    replay.playing = true;
+    app.config.headlessFrames = frameCount;
+    SDL_Log("Replaying %s: %u frames (seed %d, %d ticks per second)", path, frameCount, app.config.seed, app.config.tickRate);
+    return 0;
+}
+
+/**
+ * [Start] Opens the recording or the replay requested on the command line
+ *
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int Replay_Start() {
+    if (app.config.replayPath) return Replay_StartPlayback(app.config.replayPath);
+    if (app.config.recordPath) return Replay_StartRecording(app.config.recordPath);
+    return 0;
+}
+
+/**
+ * [PreUpdate] Reads the next recorded frame when replaying
+ *
+ * The frame time goes to the time system straight away, the input waits
+ * for Replay_EndInput(). The app stops if the file ends early.
+ */
+void Replay_PreUpdate() {
+    if (!replay.file || !replay.playing) return;
+
+    double frameSeconds = Replay_ReadDouble(replay.file);
+    replay.mousePosition.x = Replay_ReadFloat(replay.file);
+    replay.mousePosition.y = Replay_ReadFloat(replay.file);
+    Uint8 eventCount = 0;
+    if (SDL_RWread(replay.file, &eventCount, sizeof(eventCount), 1) != 1) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Recording ended after %u frames", replay.frames);
+        replay.eventCount = 0;
+        app.state.running = false;
+        return;
+    }
+    replay.eventCount = eventCount < REPLAY_MAX_EVENTS_PER_FRAME ? eventCount : REPLAY_MAX_EVENTS_PER_FRAME;
+    for (int i = 0; i < eventCount; i++) {
+        ReplayEvent event;
+        SDL_RWread(replay.file, &event.type, sizeof(event.type), 1);
+        SDL_RWread(replay.file, &event.repeat, sizeof(event.repeat), 1);
+        event.code = SDL_ReadLE16(replay.file);
+        if (i < replay.eventCount) replay.events[i] = event;
+    }
+    Time_SetFrameSeconds(frameSeconds);
+    replay.frames++;
+}
+
+/**
+ * [Event Handler] Stores an input event of the frame being recorded
+ *
+ * @param event The SDL event
+ */
+void Replay_RecordEvent(const SDL_Event* event) {
+    if (!replay.file || replay.playing) return;
+
+    ReplayEvent recorded = {0};
+    switch (event->type) {
+        case SDL_KEYDOWN:
+            recorded.type = REPLAY_EVENT_KEY_DOWN;
+            recorded.repeat = event->key.repeat;
+            recorded.code = event->key.keysym.scancode;
+            break;
+        case SDL_KEYUP:
+            recorded.type = REPLAY_EVENT_KEY_UP;
+            recorded.code = event->key.keysym.scancode;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+            recorded.type = REPLAY_EVENT_MOUSE_DOWN;
+            recorded.code = event->button.button;
+            break;
+        case SDL_MOUSEBUTTONUP:
+            recorded.type = REPLAY_EVENT_MOUSE_UP;
+            recorded.code = event->button.button;
+            break;
+        case SDL_MOUSEWHEEL:
+            if (event->wheel.y == 0) return;
+            recorded.type = event->wheel.y > 0 ? REPLAY_EVENT_WHEEL_UP : REPLAY_EVENT_WHEEL_DOWN;
+            break;
+        default:
+            return;
+    }
+    if (replay.eventCount >= REPLAY_MAX_EVENTS_PER_FRAME) {
+        SDL_Log("Recording: more than %d input events in frame %u, dropping the rest", REPLAY_MAX_EVENTS_PER_FRAME, replay.frames);
+        return;
+    }
+    replay.events[replay.eventCount++] = recorded;
+}
+
+/**
+ * @brief [Utility] Turns a stored event back into the SDL event it came from
+ *
+ * @param recorded The stored event
+ * @return SDL_Event The event, only the fields Input_Event_Handler() reads are set
+ */
+static SDL_Event Replay_ToSDLEvent(ReplayEvent recorded) {
+    SDL_Event event = {0};
+    switch (recorded.type) {
+        case REPLAY_EVENT_KEY_DOWN:
+        case REPLAY_EVENT_KEY_UP:
+            event.type = recorded.type == REPLAY_EVENT_KEY_DOWN ? SDL_KEYDOWN : SDL_KEYUP;
+            event.key.repeat = recorded.repeat;
+            event.key.keysym.scancode = recorded.code < SDL_NUM_SCANCODES ? recorded.code : SDL_SCANCODE_UNKNOWN;
+            break;
+        case REPLAY_EVENT_MOUSE_DOWN:
+        case REPLAY_EVENT_MOUSE_UP:
+            event.type = recorded.type == REPLAY_EVENT_MOUSE_DOWN ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+            event.button.button = (Uint8) recorded.code;
+            break;
+        case REPLAY_EVENT_WHEEL_UP:
+        case REPLAY_EVENT_WHEEL_DOWN:
+            event.type = SDL_MOUSEWHEEL;
+            event.wheel.y = recorded.type == REPLAY_EVENT_WHEEL_UP ? 1 : -1;
+            break;
+    }
+    return event;
+}
+
+/**
+ * [Event Handler] Ends the input of a frame
+ *
+ * Called once every event of the frame was handled. When recording, the
+ * frame is written with the mouse position the events left. When
+ * replaying, the recorded events go through Input_Event_Handler() and the
+ * mouse is moved to the recorded position.
+ */
+void Replay_EndInput() {
+    if (!replay.file) return;
+
+    if (replay.playing) {
+        for (int i = 0; i < replay.eventCount; i++) {
+            SDL_Event event = Replay_ToSDLEvent(replay.events[i]);
+            Input_Event_Handler(&event);
+        }
+        Input_SetMousePosition(replay.mousePosition);
+        return;
+    }
+
+    Replay_WriteDouble(replay.file, Time->frameSeconds);
+    Replay_WriteFloat(replay.file, Input->mouse.position.x);
+    Replay_WriteFloat(replay.file, Input->mouse.position.y);
+    Uint8 eventCount = (Uint8) replay.eventCount;
+    SDL_RWwrite(replay.file, &eventCount, sizeof(eventCount), 1);
+    for (int i = 0; i < replay.eventCount; i++) {
+        SDL_RWwrite(replay.file, &replay.events[i].type, sizeof(replay.events[i].type), 1);
+        SDL_RWwrite(replay.file, &replay.events[i].repeat, sizeof(replay.events[i].repeat), 1);
+        SDL_WriteLE16(replay.file, replay.events[i].code);
+    }
+    replay.eventCount = 0;
+    replay.frames++;
+}
+
+/**
+ * [Utility] Checks if a recording is being played back
+ *
+ * @return bool True while replaying
+ */
+bool Replay_IsPlaying() {
+    return replay.file && replay.playing;
+}
+
+/**
+ * [Quit] Finishes the recording file or closes the replay
+ *
+ * A recording only gets its frame count here, so a session that crashed
+ * leaves a file the replay refuses.
+ */
+void Replay_Quit() {
+    if (!replay.file) return;
+    if (!replay.playing) {
+        SDL_RWseek(replay.file, replay.frameCountOffset, RW_SEEK_SET);
+        SDL_WriteLE32(replay.file, replay.frames);
+        SDL_Log("Recorded %u frames", replay.frames);
+    }
+    SDL_RWclose(replay.file);
+    replay.file = NULL;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file sprite_atlas.c
+ * @brief Runtime texture atlas implementation
+ *
+ * Packs images into atlas pages with a simple shelf packer: images are
+ * placed left to right on a row, and a new row is opened below the
+ * tallest image once the current one is full.
+ *
+ * @author Mango
+ * @date 2025-04-14
+ */
+
+#include <sprite_atlas.h>
+#include <assets.h>
+#include <app.h>
+#include <profiler.h>
+#include <string.h>
+#include <stdlib.h>
+
+/**
+ * @brief One texture holding many packed images
+ */
+typedef struct SpriteAtlasPage {
+    SDL_Texture* texture;   /**< The page texture */
+    int shelfX;             /**< Next free x on the current row */
+    int shelfY;             /**< Top of the current row */
+    int shelfHeight;        /**< Height of the tallest image on the current row */
+} SpriteAtlasPage;
+
+/**
+ * @brief An image that has been loaded through the atlas
+ */
+typedef struct SpriteAtlasEntry {
+    char* path;             /**< Path the image was loaded from */
+    SpriteRegion region;    /**< Where the image ended up */
+} SpriteAtlasEntry;
+
+static SpriteAtlasPage atlasPages[SPRITE_ATLAS_MAX_PAGES];
+static int atlasPageCount = 0;
+static SpriteAtlasEntry atlasEntries[SPRITE_ATLAS_MAX_ENTRIES];
+static int atlasEntryCount = 0;
+
+/**
+ * @brief [Utility] Reserves space for an image on a page
+ *
+ * @param page The page to pack into
+ * @param w Width of the image
+ * @param h Height of the image
+ * @param rect Receives the reserved area
+ * @return bool False if the page has no room left
+ */
+static bool SpriteAtlas_PackOnPage(SpriteAtlasPage* page, int w, int h, SDL_Rect* rect) {
+    int paddedW = w + SPRITE_ATLAS_PADDING;
+    int paddedH = h + SPRITE_ATLAS_PADDING;
+    if (page->shelfX + paddedW > SPRITE_ATLAS_PAGE_SIZE) {
+        // Open a new row below the current one
+        page->shelfY += page->shelfHeight;
+        page->shelfX = 0;
+        page->shelfHeight = 0;
+    }
+    if (page->shelfX + paddedW > SPRITE_ATLAS_PAGE_SIZE) return false;
+    if (page->shelfY + paddedH > SPRITE_ATLAS_PAGE_SIZE) return false;
+
+    *rect = (SDL_Rect) {page->shelfX, page->shelfY, w, h};
+    page->shelfX += paddedW;
+    if (paddedH > page->shelfHeight) page->shelfHeight = paddedH;
+    return true;
+}
+
+/**
+ * @brief [Utility] Creates a new empty atlas page
+ *
+ * @return SpriteAtlasPage* The new page, or NULL if no more pages can be made
+ */
+static SpriteAtlasPage* SpriteAtlas_AddPage() {
+    if (atlasPageCount >= SPRITE_ATLAS_MAX_PAGES) return NULL;
+    SDL_Texture* texture = SDL_CreateTexture(
+        app.resources.renderer,
+        SDL_PIXELFORMAT_RGBA32,
+        SDL_TEXTUREACCESS_STATIC,
+        SPRITE_ATLAS_PAGE_SIZE,
+        SPRITE_ATLAS_PAGE_SIZE
+    );
+    if (!texture) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create atlas page: %s", SDL_GetError());
+        return NULL;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    PROFILER_COUNT(PROFILER_COUNTER_TEXTURES_CREATED, 1);
+
+    SpriteAtlasPage* page = &atlasPages[atlasPageCount++];
+    *page = (SpriteAtlasPage) {texture, 0, 0, 0};
+    return page;
+}
+
+/**
+ * [Utility] Loads an image into the atlas
+ *
+ * Images are packed on the first page with room for them. Images that
+ * are bigger than a page, or that arrive after every page is full, get
+ * a texture of their own so loading never fails because of the atlas.
+ *
+ * @param path Path of the image file
+ * @param region Receives the texture and rect of the image
+ * @return int Status code (0 for success, non-zero for error)
+ */
+int SpriteAtlas_Load(const char* path, SpriteRegion* region) {
+    for (int i = 0; i < atlasEntryCount; i++) {
+        if (strcmp(atlasEntries[i].path, path) == 0) {
+            *region = atlasEntries[i].region;
+            return 0;
+        }
+    }
+
+    // Already decoded at startup in most cases (see asset_loader.h)
+    SDL_Surface* surface = Assets_LoadSurface(path);
+    if (!surface) return 1;
+
+    SpriteRegion packed = {NULL, {0, 0, surface->w, surface->h}};
+    for (int i = 0; i < atlasPageCount && !packed.texture; i++) {
+        if (SpriteAtlas_PackOnPage(&atlasPages[i], surface->w, surface->h, &packed.rect)) {
+            packed.texture = atlasPages[i].texture;
+        }
+    }
+    if (!packed.texture) {
+        SpriteAtlasPage* page = SpriteAtlas_AddPage();
+        if (page && SpriteAtlas_PackOnPage(page, surface->w, surface->h, &packed.rect)) {
+            packed.texture = page->texture;
+        }
+    }
+
+    if (packed.texture) {
+        SDL_UpdateTexture(packed.texture, &packed.rect, surface->pixels, surface->pitch);
+    } else {
+        packed.rect = (SDL_Rect) {0, 0, surface->w, surface->h};
+        packed.texture = SDL_CreateTextureFromSurface(app.resources.renderer, surface);
+    }
+    SDL_FreeSurface(surface);
+    if (!packed.texture) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create texture for %s: %s", path, SDL_GetError());
+        return 1;
+    }
+    // Uploads into a page count too, they are what a first use at runtime costs
+    PROFILER_COUNT(PROFILER_COUNTER_TEXTURES_CREATED, 1);
+
+    if (atlasEntryCount < SPRITE_ATLAS_MAX_ENTRIES) {
+        atlasEntries[atlasEntryCount++] = (SpriteAtlasEntry) {strdup(path), packed};
+    } else {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Sprite atlas is full, %s will not be shared", path);
+    }
+    *region = packed;
+    return 0;
+}
+
+/**
+ * [Quit] Destroys every atlas page and forgets all loaded images
+ */
+void SpriteAtlas_Destroy() {
+    for (int i = 0; i < atlasEntryCount; i++) {
+        // Standalone textures are not pages, so they are destroyed here
+        bool isPage = false;
+        for (int j = 0; j < atlasPageCount; j++) {
+            if (atlasEntries[i].region.texture == atlasPages[j].texture) isPage = true;
+        }
+        if (!isPage) SDL_DestroyTexture(atlasEntries[i].region.texture);
+        free(atlasEntries[i].path);
+    }
+    for (int i = 0; i < atlasPageCount; i++) {
+        SDL_DestroyTexture(atlasPages[i].texture);
+    }
+    atlasEntryCount = 0;
+    atlasPageCount = 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file sprite_batch.c
+ * @brief Sprite batch implementation
+ *
+ * Every sprite becomes a quad of four vertices. The quads are transformed
+ * on the CPU (flip through the texture coordinates, then rotation around
+ * the given center, matching SDL_RenderCopyEx) and submitted together.
+ *
+ * @author Mango
+ * @date 2025-04-14
+ */
+
+#include <sprite_batch.h>
+#include <app.h>
+
+static SDL_Vertex batchVertices[SPRITE_BATCH_MAX_SPRITES * 4];
+static int batchIndices[SPRITE_BATCH_MAX_SPRITES * 6];
+static int batchSpriteCount = 0;
+static SDL_Texture* batchTexture = NULL;
+static int batchTextureW = 0;
+static int batchTextureH = 0;
+static bool batchActive = false;
+
+/**
+ * [Start] Opens a batch
+ *
+ * The index buffer never changes, so it is filled on the first use.
+ */
+void SpriteBatch_Begin() {
+    static bool indicesReady = false;
+    if (!indicesReady) {
+        for (int i = 0; i < SPRITE_BATCH_MAX_SPRITES; i++) {
+            int* quad = &batchIndices[i * 6];
+            quad[0] = i * 4;
+            quad[1] = i * 4 + 1;
+            quad[2] = i * 4 + 2;
+            quad[3] = i * 4 + 2;
+            quad[4] = i * 4 + 3;
+            quad[5] = i * 4;
+        }
+        indicesReady = true;
+    }
+    batchActive = true;
+    batchSpriteCount = 0;
+    batchTexture = NULL;
+}
+
+/**
+ * [Render] Draws every queued sprite now and keeps the batch open
+ */
+void SpriteBatch_Flush() {
+    if (batchSpriteCount == 0 || !batchTexture) return;
+    if (SDL_RenderGeometry(
+            app.resources.renderer,
+            batchTexture,
+            batchVertices, batchSpriteCount * 4,
+            batchIndices, batchSpriteCount * 6
+        ) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to draw sprite batch: %s", SDL_GetError());
+    }
+    batchSpriteCount = 0;
+}
+
+/**
+ * [Render] Draws every queued sprite and closes the batch
+ */
+void SpriteBatch_End() {
+    SpriteBatch_Flush();
+    batchActive = false;
+    batchTexture = NULL;
+}
+
+/**
+ * [Utility] Draws a sprite right away with SDL_RenderCopyEx
+ */
+static void SpriteBatch_DrawImmediate(
+    SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dest,
+    float angle, const SDL_Point* center, SDL_RendererFlip flip, Uint8 alpha
+) {
+    Uint8 previousAlpha = 255;
+    if (alpha != 255) {
+        SDL_GetTextureAlphaMod(texture, &previousAlpha);
+        SDL_SetTextureAlphaMod(texture, alpha);
+    }
+    SDL_RenderCopyEx(app.resources.renderer, texture, src, dest, angle, center, flip);
+    if (alpha != 255) SDL_SetTextureAlphaMod(texture, previousAlpha);
+}
+
+/**
+ * [Render] Queues a sprite, or draws it right away if no batch is open
+ *
+ * Switching to another texture flushes what was queued for the previous
+ * one, so sprites keep their draw order.
+ *
+ * @param texture The texture to draw from
+ * @param src Area of the texture to draw, NULL for the whole texture
+ * @param dest Where to draw on screen
+ * @param angle Rotation angle in degrees, clockwise
+ * @param center Rotation center relative to dest, NULL for the center of dest
+ * @param flip The flip mode for the sprite
+ * @param alpha Opacity of the sprite
+ */
+void SpriteBatch_Draw(
+    SDL_Texture* texture, const SDL_Rect* src, const SDL_Rect* dest,
+    float angle, const SDL_Point* center, SDL_RendererFlip flip, Uint8 alpha
+) {
+    if (!texture || !dest) return;
+    if (!batchActive) {
+        SpriteBatch_DrawImmediate(texture, src, dest, angle, center, flip, alpha);
+        return;
+    }
+
+    if (texture != batchTexture) {
+        SpriteBatch_Flush();
+        batchTexture = texture;
+        SDL_QueryTexture(texture, NULL, NULL, &batchTextureW, &batchTextureH);
+    }
+    if (batchSpriteCount >= SPRITE_BATCH_MAX_SPRITES) SpriteBatch_Flush();
+
+    SDL_Rect source = src ? *src : (SDL_Rect) {0, 0, batchTextureW, batchTextureH};
+    float u0 = (float) source.x / batchTextureW;
+    float v0 = (float) source.y / batchTextureH;
+    float u1 = (float) (source.x + source.w) / batchTextureW;
+    float v1 = (float) (source.y + source.h) / batchTextureH;
+    if (flip & SDL_FLIP_HORIZONTAL) { float u = u0; u0 = u1; u1 = u; }
+    if (flip & SDL_FLIP_VERTICAL) { float v = v0; v0 = v1; v1 = v; }
+
+    // Corners relative to the rotation center, in top-left, top-right, bottom-right, bottom-left order
+    float pivotX = center ? center->x : dest->w / 2.0f;
+    float pivotY = center ? center->y : dest->h / 2.0f;
+    float cornersX[4] = {-pivotX, dest->w - pivotX, dest->w - pivotX, -pivotX};
+    float cornersY[4] = {-pivotY, -pivotY, dest->h - pivotY, dest->h - pivotY};
+    float texU[4] = {u0, u1, u1, u0};
+    float texV[4] = {v0, v0, v1, v1};
+
+    float radians = angle * M_PI / 180.0f;
+    float cosA = angle != 0 ? SDL_cosf(radians) : 1.0f;
+    float sinA = angle != 0 ? SDL_sinf(radians) : 0.0f;
+
+    SDL_Vertex* quad = &batchVertices[batchSpriteCount * 4];
+    for (int i = 0; i < 4; i++) {
+        quad[i].position.x = dest->x + pivotX + cornersX[i] * cosA - cornersY[i] * sinA;
+        quad[i].position.y = dest->y + pivotY + cornersX[i] * sinA + cornersY[i] * cosA;
+        quad[i].color = (SDL_Color) {255, 255, 255, alpha};
+        quad[i].tex_coord.x = texU[i];
+        quad[i].tex_coord.y = texV[i];
+    }
+    batchSpriteCount++;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file stress_test.c
+ * @brief Enemy scaling stress test scene
+ *
+ * Spawns a large, constant population of every enemy type into one room
+ * and measures how long each type takes to update, to query collisions
+ * and to render, so engine scaling can be checked without playing.
+ *
+ * @author Mango
+ * @date 2025-04-12
+ */
+
+#include <stress_test.h>
+#include <app.h>
+#include <enemy.h>
+#include <enemy_types.h>
+#include <maps.h>
+#include <camera.h>
+#include <input.h>
+#include <UI_text.h>
+#include <sprite_batch.h>
+#include <stdio.h>
+
+/**
+ * @brief Accumulated timings of one enemy type over the current report window
+ */
+typedef struct StressTypeStats {
+    Uint64 updateTicks;     /**< Ticks spent in the type's update batch, over stressSteps */
+    Uint64 collisionTicks;  /**< Part of updateTicks spent in Collider_Check */
+    Uint64 renderTicks;     /**< Ticks spent submitting the type's draw calls, over stressRenderFrames */
+    int collisionChecks;    /**< Collider_Check calls made by the type */
+} StressTypeStats;
+
+static EnvironmentChunk* stressRoom = NULL;
+static StressTypeStats stressStats[ENEMY_TYPE_COUNT];
+static Uint64 stressEffectsTicks = 0;
+static int stressSteps = 0;           /**< Fixed simulation steps in the current window */
+static int stressRenderFrames = 0;    /**< Rendered frames in the current window */
+static float stressReportTimer = 0;
+static UIElement* stressTexts[ENEMY_TYPE_COUNT + 1] = {NULL};
+
+/**
+ * @brief [Utility] Converts performance counter ticks to average milliseconds per step or frame
+ *
+ * @param ticks Ticks accumulated over the window
+ * @param count Fixed steps or rendered frames the ticks were spread over
+ */
+static double Stress_TicksToMs(Uint64 ticks, int count) {
+    if (count == 0) return 0;
+    return (double) ticks * 1000.0 / (double) SDL_GetPerformanceFrequency() / count;
+}
+
+/**
+ * @brief [Utility] Spawns one enemy that is active immediately
+ *
+ * Skips the spawn indicator and the spawn-overlap kill of Enemy_HandleSpawning(),
+ * so the population stays exactly at the requested size.
+ *
+ * @param type The type of enemy to spawn
+ * @return bool False if every enemy slot is taken
+ */
+static bool Stress_SpawnEnemy(EnemyType type) {
+    EnemyData* enemy = Enemy_Spawn(*enemyList[type], Chunk_GetRandomTileCenterInRoom(stressRoom));
+    if (!enemy) return false;
+
+    Timer_Destroy(enemy->resources.timer);
+    enemy->resources.timer = NULL;
+    enemy->state.isSpawning = false;
+    enemy->state.collider.layer = enemyList[type]->state.collider.layer;
+    return true;
+}
+
+/**
+ * @brief [Utility] Refills every non-boss type back to the requested count
+ */
+static void Stress_TopUp() {
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        // The boss pins itself to the chunk center and drives global lazers
+        if (type == ENEMY_TYPE_LIBET) continue;
+        while (EnemyBuckets[type].count < app.config.stressEnemyCount) {
+            if (!Stress_SpawnEnemy(type)) return;
+        }
+    }
+}
+
+/**
+ * @brief [Start] Prepares the stress room and spawns the enemies
+ *
+ * Enlarges the start room, closes its hallways, moves the player and camera
+ * into it and switches the app to SCENE_STRESS_TEST.
+ */
+void Stress_Start() {
+    stressRoom = testMap.startChunk;
+    stressRoom->roomSize = (Vec2) {STRESS_ROOM_SIZE_TILE, STRESS_ROOM_SIZE_TILE};
+    stressRoom->hallways = HALLWAY_NONE;
+    stressRoom->inCombat = true;
+    Chunk_GenerateTilesButVoid(stressRoom);
+
+    player.state.position = Chunk_GetChunkCenter(stressRoom);
+    camera.position = player.state.position;
+
+    Stress_TopUp();
+    ColliderProfile.enabled = true;
+    app.state.currentScene = SCENE_STRESS_TEST;
+    SDL_Log("Stress test: %d enemies of each type, %d enemy slots, %d collider slots",
+        app.config.stressEnemyCount, Enemy_Capacity, ColliderCapacity);
+}
+
+/**
+ * @brief [Utility] Logs the averages of the current window and refreshes the overlay
+ */
+static void Stress_Report() {
+    char line[96];
+    SDL_Log("Stress test report (%d steps, %d frames; update and collision per step, render per frame):",
+        stressSteps, stressRenderFrames);
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        if (type == ENEMY_TYPE_LIBET) continue;
+        StressTypeStats* stats = &stressStats[type];
+        snprintf(line, sizeof(line), "%-10s %5d  upd %6.2fms/step  col %6.2fms/step (%d)  ren %6.2fms/frame",
+            enemyList[type]->name,
+            EnemyBuckets[type].count,
+            Stress_TicksToMs(stats->updateTicks, stressSteps),
+            Stress_TicksToMs(stats->collisionTicks, stressSteps),
+            stressSteps ? stats->collisionChecks / stressSteps : 0,
+            Stress_TicksToMs(stats->renderTicks, stressRenderFrames)
+        );
+        SDL_Log("  %s", line);
+        if (stressTexts[type]) UI_ChangeText(stressTexts[type], line);
+    }
+    snprintf(line, sizeof(line), "Shared effects  %6.2fms/step  colliders %d",
+        Stress_TicksToMs(stressEffectsTicks, stressSteps), ColliderCount);
+    SDL_Log("  %s", line);
+    if (stressTexts[ENEMY_TYPE_COUNT]) UI_ChangeText(stressTexts[ENEMY_TYPE_COUNT], line);
+
+    SDL_memset(stressStats, 0, sizeof(stressStats));
+    stressEffectsTicks = 0;
+    stressSteps = 0;
+    stressRenderFrames = 0;
+}
+
+/**
+ * @brief [PostUpdate] Updates every enemy type while timing it
+ *
+ * Runs once per fixed step, so its timings are averaged per step rather
+ * than per rendered frame.
+ *
+ * Collision time is attributed to the type whose batch issued the
+ * Collider_Check calls. Bullet collisions resolved by the shared
+ * particle emitters are counted under shared effects.
+ */
+void Stress_Update() {
+    if (Input->keyboard.keys[SDL_SCANCODE_ESCAPE].pressed) {
+        app.state.running = false;
+        return;
+    }
+
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        StressTypeStats* stats = &stressStats[type];
+        Uint64 collisionTicks = ColliderProfile.checkTicks;
+        int collisionChecks = ColliderProfile.checkCount;
+        Uint64 start = SDL_GetPerformanceCounter();
+
+        Enemy_UpdateType(type);
+
+        stats->updateTicks += SDL_GetPerformanceCounter() - start;
+        stats->collisionTicks += ColliderProfile.checkTicks - collisionTicks;
+        stats->collisionChecks += ColliderProfile.checkCount - collisionChecks;
+    }
+    Enemy_CompactBuckets();
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    Enemy_UpdateEffects();
+    stressEffectsTicks += SDL_GetPerformanceCounter() - start;
+
+    Stress_TopUp();
+    stressSteps++;
+    stressReportTimer += Time->rawDeltaTimeSeconds;
+    if (stressReportTimer >= STRESS_REPORT_INTERVAL) {
+        stressReportTimer = 0;
+        Stress_Report();
+    }
+}
+
+/**
+ * @brief [Render] Renders the stress room while timing each enemy type
+ *
+ * Each type gets its own sprite batch, so the flush is counted with it.
+ * Render times are CPU-side submission costs; the GPU may finish later.
+ */
+void Stress_Render() {
+    Map_Render();
+    for (int type = 0; type < ENEMY_TYPE_COUNT; type++) {
+        Uint64 start = SDL_GetPerformanceCounter();
+        SpriteBatch_Begin();
+        Enemy_RenderType(type);
+        SpriteBatch_End();
+        stressStats[type].renderTicks += SDL_GetPerformanceCounter() - start;
+    }
+    stressRenderFrames++;
+    Enemy_RenderEffects();
+
+    for (int i = 0; i <= ENEMY_TYPE_COUNT; i++) {
+        if (i == ENEMY_TYPE_LIBET) continue;
+        if (!stressTexts[i]) {
+            // Created once, the text only changes when a report is made
+            stressTexts[i] = UI_CreateText(
+                "Measuring...",
+                (SDL_Rect) {10, 60 + 10 * i, 0, 0},
+                (SDL_Color) {255, 255, 255, 255},
+                1.0f,
+                UI_TEXT_ALIGN_LEFT,
+                app.resources.textFont
+            );
+        }
+        UI_UpdateText(stressTexts[i]);
+        UI_RenderText(stressTexts[i]);
+    }
+}
@@ -14,6 +14,7 @@
 #include <timer.h>
 #include <time_system.h>
 #include <stdlib.h>
+#include <profiler.h>
 
 /**
  * @brief [Start/Utility] Creates a timer with the specified duration
@@ -26,6 +27,7 @@
  */
 Timer* Timer_Create(float duration) {
     Timer *timer = malloc(sizeof(Timer));
+    PROFILER_COUNT(PROFILER_COUNTER_HEAP_ALLOCATIONS, 1);
     timer->startTime = Time->programElapsedTimeSeconds;
     timer->elapsedTime = 0;
     timer->duration = duration;
@@ -34,6 +36,19 @@ Timer* Timer_Create(float duration) {
     return timer;
 }
 
+/**
+ * @brief [Utility] Changes the duration of a timer
+ *
+ * Lets a timer be reused for a cooldown whose length changes, instead of
+ * creating a new one each time. Takes effect from the next check.
+ *
+ * @param timer Pointer to the timer to change
+ * @param duration The new duration in seconds
+ */
+void Timer_SetDuration(Timer *timer, float duration) {
+    timer->duration = duration;
+}
+
 /**
  * @brief [Utility] Starts or restarts a timer
  *
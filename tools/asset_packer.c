@@ -0,0 +1,169 @@
+/**
+ * @file asset_packer.c
+ * @brief Build step that packs the Assets folder into one archive
+ *
+ * Usage: asset_packer ROOT OUTPUT
+ *
+ * Every file under ROOT/Assets is stored under its path relative to ROOT,
+ * like "Assets/Images/title.png", which is the path the game asks for.
+ * The layout is described in asset_archive_format.h. The build runs it
+ * after compiling (see CMakeLists.txt), writing Assets.pak next to the
+ * executable.
+ *
+ * @author Mango
+ * @date 2025-04-19
+ */
+
+#include <asset_archive_format.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+/**
+ * @brief A file found under the Assets folder
+ */
+typedef struct PackedFile {
+    char* path;         /**< Path relative to the root, with forward slashes */
+    char* diskPath;     /**< Path to open the file with */
+    uint64_t size;      /**< Size of the file */
+    uint32_t hash;      /**< Hash of path */
+} PackedFile;
+
+static PackedFile* files = NULL;
+static int fileCount = 0;
+static int fileCapacity = 0;
+
+/**
+ * @brief Copies a string into a new allocation
+ */
+static char* Packer_Copy(const char* text) {
+    char* copy = malloc(strlen(text) + 1);
+    if (copy) strcpy(copy, text);
+    return copy;
+}
+
+/**
+ * @brief Adds every file under a folder, recursively
+ *
+ * @param root The root the stored paths are relative to
+ * @param relative The folder to walk, relative to root
+ * @return int Status code (0 for success, non-zero for error)
+ */
+static int Packer_AddFolder(const char* root, const char* relative) {
+    char folder[1024];
+    snprintf(folder, sizeof(folder), "%s/%s", root, relative);
+    DIR* dir = opendir(folder);
+    if (!dir) {
+        fprintf(stderr, "asset_packer: cannot open %s\n", folder);
+        return 1;
+    }
+
+    struct dirent* item;
+    while ((item = readdir(dir))) {
+        if (item->d_name[0] == '.') continue;
+        char path[1024];
+        char diskPath[2048];
+        snprintf(path, sizeof(path), "%s/%s", relative, item->d_name);
+        snprintf(diskPath, sizeof(diskPath), "%s/%s", root, path);
+
+        struct stat info;
+        if (stat(diskPath, &info) != 0) continue;
+        if (S_ISDIR(info.st_mode)) {
+            if (Packer_AddFolder(root, path)) {
+                closedir(dir);
+                return 1;
+            }
+            continue;
+        }
+        if (fileCount == fileCapacity) {
+            fileCapacity = fileCapacity > 0 ? fileCapacity * 2 : 256;
+            files = realloc(files, fileCapacity * sizeof(PackedFile));
+            if (!files) {
+                closedir(dir);
+                return 1;
+            }
+        }
+        files[fileCount++] = (PackedFile) {
+            Packer_Copy(path),
+            Packer_Copy(diskPath),
+            (uint64_t) info.st_size,
+            AssetArchive_Hash(path, (uint32_t) strlen(path))
+        };
+    }
+    closedir(dir);
+    return 0;
+}
+
+/**
+ * @brief Orders files by hash, then path, which is how the game searches the index
+ */
+static int Packer_Compare(const void* a, const void* b) {
+    const PackedFile* first = a;
+    const PackedFile* second = b;
+    if (first->hash != second->hash) return first->hash < second->hash ? -1 : 1;
+    return strcmp(first->path, second->path);
+}
+
+/**
+ * @brief Rounds an offset up to ASSET_ARCHIVE_ALIGNMENT
+ */
+static uint64_t Packer_Align(uint64_t offset) {
+    return (offset + ASSET_ARCHIVE_ALIGNMENT - 1) & ~(uint64_t) (ASSET_ARCHIVE_ALIGNMENT - 1);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: asset_packer ROOT OUTPUT\n");
+        return 1;
+    }
+    if (Packer_AddFolder(argv[1], "Assets")) return 1;
+    qsort(files, fileCount, sizeof(PackedFile), Packer_Compare);
+
+    // Lay out the index, the path strings, then the data
+    uint64_t pathsStart = sizeof(AssetArchiveHeader) + (uint64_t) fileCount * sizeof(AssetArchiveEntry);
+    uint64_t pathsSize = 0;
+    for (int i = 0; i < fileCount; i++) pathsSize += strlen(files[i].path);
+    uint64_t dataOffset = Packer_Align(pathsStart + pathsSize);
+
+    FILE* output = fopen(argv[2], "wb");
+    if (!output) {
+        fprintf(stderr, "asset_packer: cannot create %s\n", argv[2]);
+        return 1;
+    }
+    AssetArchiveHeader header = {ASSET_ARCHIVE_MAGIC, ASSET_ARCHIVE_VERSION, (uint32_t) fileCount, 0};
+    fwrite(&header, sizeof(header), 1, output);
+
+    uint64_t pathOffset = pathsStart;
+    for (int i = 0; i < fileCount; i++) {
+        uint32_t pathLength = (uint32_t) strlen(files[i].path);
+        AssetArchiveEntry entry = {files[i].hash, (uint32_t) pathOffset, pathLength, 0, dataOffset, files[i].size};
+        fwrite(&entry, sizeof(entry), 1, output);
+        pathOffset += pathLength;
+        dataOffset = Packer_Align(dataOffset + files[i].size);
+    }
+    for (int i = 0; i < fileCount; i++) fwrite(files[i].path, 1, strlen(files[i].path), output);
+
+    uint64_t total = 0;
+    char buffer[65536];
+    for (int i = 0; i < fileCount; i++) {
+        long position = ftell(output);
+        long aligned = (long) Packer_Align((uint64_t) position);
+        for (long pad = position; pad < aligned; pad++) fputc(0, output);
+
+        FILE* input = fopen(files[i].diskPath, "rb");
+        if (!input) {
+            fprintf(stderr, "asset_packer: cannot read %s\n", files[i].diskPath);
+            fclose(output);
+            return 1;
+        }
+        size_t read;
+        while ((read = fread(buffer, 1, sizeof(buffer), input)) > 0) fwrite(buffer, 1, read, output);
+        fclose(input);
+        total += files[i].size;
+    }
+    fclose(output);
+    printf("asset_packer: %d files, %.1f MB written to %s\n", fileCount, total / (1024.0 * 1024.0), argv[2]);
+    return 0;
+}